@@ -0,0 +1,255 @@
+#include <iostream>
+
+#include "alchemist.h"
+#include "pcg_converter.h"
+#include "helpers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Counts the C++ heap allocations. The C loader (malloc/calloc) is not counted
+static std::atomic<uint64_t> g_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+	g_allocations++;
+	if (void* ptr = std::malloc(size ? size : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete" // The replaced operator new is malloc based
+#endif
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+struct StageStats
+{
+	std::string name;
+	std::vector<double> samples; // Microseconds
+	uint64_t allocations = 0;
+	uint64_t bytes = 0; // Output size, when the stage produces some
+
+	void print() const
+	{
+		if (samples.empty())
+			return;
+
+		auto sorted = samples;
+		std::sort(sorted.begin(), sorted.end());
+
+		auto percentile = [&](double p)
+		{
+			auto index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+			return sorted[index];
+		};
+
+		double total = 0.0;
+		for (auto sample : sorted)
+			total += sample;
+
+		std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(7) << sorted.size()
+			<< std::setw(12) << percentile(0.5)
+			<< std::setw(12) << percentile(0.9)
+			<< std::setw(12) << percentile(0.99)
+			<< std::setw(12) << sorted.back()
+			<< std::setw(12) << (total > 0.0 ? sorted.size() * 1e6 / total : 0.0)
+			<< std::setw(12) << (total > 0.0 ? bytes / total : 0.0) // bytes/us == MB/s
+			<< std::setw(12) << allocations / sorted.size() << "\n";
+	}
+};
+
+// Friend of PCG_Converter: runs the private stages one at a time
+class PCG_ConverterBenchmark
+{
+public:
+	template<typename F>
+	static void measure(StageStats& stats, F&& func)
+	{
+		auto allocations = g_allocations.load();
+		auto start = Clock::now();
+		func();
+		auto end = Clock::now();
+		stats.allocations += g_allocations.load() - allocations;
+		stats.samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+
+	// The shared resources are only loaded by the first converter: each run loads them again in its own copy
+	typedef PCG_Converter::ConverterResources Resources;
+
+	static bool retrieveTemplatesData(PCG_Converter& converter, Resources& resources) { return converter.retrieveTemplatesData(resources); }
+	static bool retrieveGMData(PCG_Converter& converter, Resources& resources) { return converter.retrieveGMData(resources); }
+
+	static void patchProgram(PCG_Converter& converter, unsigned char* data)
+	{
+		converter.patchProgram(data);
+	}
+
+	static void writeProgram(PCG_Converter& converter, int presetId, const std::string& presetName, std::ostream& out)
+	{
+		converter.jsonWriteHeaderBegin(out, presetName, EPatchMode::Program, converter.m_targetModel, converter.m_dictProgParams);
+		converter.jsonWriteHeaderEnd(out, presetId, 0, "A", "Program");
+		converter.jsonWriteDSPSettings(out, converter.m_dictProgParams);
+		converter.jsonWriteEnd(out, "program");
+	}
+
+	static std::vector<PCG_Converter::Timber> patchCombi(PCG_Converter& converter, unsigned char* data)
+	{
+		return converter.patchCombi(data);
+	}
+
+	static void writeCombi(PCG_Converter& converter, int presetId, const std::string& presetName,
+		const std::vector<PCG_Converter::Timber>& timbers, std::ostream& out)
+	{
+		converter.jsonWriteHeaderBegin(out, presetName, EPatchMode::Combi, converter.m_targetModel, converter.m_dictCombiParams);
+		converter.jsonWriteTimbers(out, timbers);
+		converter.jsonWriteHeaderEnd(out, presetId, 0, "A", "Combi");
+		converter.jsonWriteDSPSettings(out, converter.m_dictCombiParams);
+		converter.jsonWriteEnd(out, "combi");
+	}
+};
+
+typedef PCG_ConverterBenchmark Bench;
+
+void printHeader(const std::string& title)
+{
+	std::cout << "\n### " << title << " ###\n";
+	std::cout << std::left << std::setw(32) << "Stage" << std::right
+		<< std::setw(7) << "Runs"
+		<< std::setw(12) << "p50 (us)"
+		<< std::setw(12) << "p90 (us)"
+		<< std::setw(12) << "p99 (us)"
+		<< std::setw(12) << "max (us)"
+		<< std::setw(12) << "runs/s"
+		<< std::setw(12) << "MB/s"
+		<< std::setw(12) << "allocs/run" << "\n";
+}
+
+void benchmarkPCG(const std::string& pcgPath, int iterations)
+{
+	printHeader(std::filesystem::path(pcgPath).filename().string());
+
+	StageStats load{ "LoadTritonPCG" };
+	for (int i = 0; i < iterations; i++)
+	{
+		EnumKorgModel model;
+		KorgPCG* loaded = nullptr;
+		Bench::measure(load, [&]() { loaded = LoadTritonPCG(pcgPath.c_str(), model); });
+		load.bytes += std::filesystem::file_size(pcgPath);
+		DeleteKorgPCG(loaded);
+	}
+	load.print();
+
+	EnumKorgModel model;
+	auto* pcg = LoadTritonPCG(pcgPath.c_str(), model);
+	if (!pcg)
+	{
+		std::cerr << "Can't load " << pcgPath << "\n";
+		return;
+	}
+
+	auto converter = PCG_Converter(model, pcg, "", [](const std::string&) {});
+	if (!converter.isInitialized())
+	{
+		std::cerr << "Converter initialization failed, check the Data folder\n";
+		DeleteKorgPCG(pcg);
+		return;
+	}
+
+	StageStats templates{ "retrieveTemplatesData" };
+	StageStats gmData{ "retrieveGMData" };
+	for (int i = 0; i < iterations; i++)
+	{
+		Bench::Resources resources;
+		Bench::measure(templates, [&]() { Bench::retrieveTemplatesData(converter, resources); });
+		Bench::measure(gmData, [&]() { Bench::retrieveGMData(converter, resources); });
+	}
+	templates.print();
+	gmData.print();
+
+	StageStats programs{ "patchProgramToStream" };
+	StageStats programsJson{ "  JSON emission" };
+	StageStats combis{ "patchCombiToStream" };
+	StageStats combisJson{ "  JSON emission" };
+
+	std::ostringstream out;
+	auto resetOut = [&]() { out.str(""); out.clear(); };
+
+	auto forEachPreset = [](KorgBanks* banks, auto&& func)
+	{
+		for (uint32_t i = 0; banks && i < banks->count; i++)
+		{
+			auto* bank = banks->bank[i];
+			for (uint32_t j = 0; j < bank->count; j++)
+			{
+				auto* item = GetKorgItem(bank, j);
+				func(static_cast<int>(j), std::string((char*)item->data, 16), item->data);
+			}
+		}
+	};
+
+	forEachPreset(pcg->Program, [&](int presetId, const std::string& name, unsigned char* data)
+	{
+		resetOut();
+		Bench::measure(programs, [&]() { converter.patchProgramToStream(0, presetId, name, data, "A", out); });
+		programs.bytes += out.tellp();
+
+		// Same preset again, to split the decoding from the JSON emission
+		Bench::patchProgram(converter, data);
+		resetOut();
+		Bench::measure(programsJson, [&]() { Bench::writeProgram(converter, presetId, name, out); });
+		programsJson.bytes += out.tellp();
+	});
+
+	forEachPreset(pcg->Combination, [&](int presetId, const std::string& name, unsigned char* data)
+	{
+		resetOut();
+		Bench::measure(combis, [&]() { converter.patchCombiToStream(0, presetId, name, data, "A", out); });
+		combis.bytes += out.tellp();
+
+		auto timbers = Bench::patchCombi(converter, data);
+		resetOut();
+		Bench::measure(combisJson, [&]() { Bench::writeCombi(converter, presetId, name, timbers, out); });
+		combisJson.bytes += out.tellp();
+	});
+
+	programs.print();
+	programsJson.print();
+	combis.print();
+	combisJson.print();
+
+	DeleteKorgPCG(pcg);
+}
+
+int main(int argc, const char* argv[])
+{
+	int iterations = 10;
+	if (argc > 1)
+		iterations = std::max(1, atoi(argv[1]));
+
+	std::cout << "Usage: PCGToVST_bench [Iterations]. Iterations of the load stages: " << iterations
+		<< ". Allocations only count C++ operator new.\n";
+
+	auto dataFolder = std::filesystem::path(PCG_Converter::getDataFolder());
+	benchmarkPCG((dataFolder / "Factory_Triton.PCG").string(), iterations);
+	benchmarkPCG((dataFolder / "Factory_TritonExtreme.PCG").string(), iterations);
+
+	return 0;
+}
@@ -8,6 +8,13 @@
 #include <fstream>
 #include <sstream>
 #include <filesystem>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 
 #include "unit_tests.h"
 
@@ -35,22 +42,214 @@ string_map generic_parse(std::vector<std::string> as, Keyword keyword)
 	return result;
 }
 
+const uint32_t kMaxThreads = 256;
+
+// Count between 1 and kMaxThreads
+bool parseThreadCount(const std::string& text, uint32_t& out_count)
+{
+	const char* begin = text.c_str();
+	char* end = nullptr;
+	errno = 0;
+	long count = strtol(begin, &end, 10);
+	if (end == begin || *end != '\0' || errno == ERANGE || count < 1 || count > static_cast<long>(kMaxThreads))
+		return false;
+
+	out_count = static_cast<uint32_t>(count);
+	return true;
+}
+
 void printUsage()
 {
 	std::cout << "Usage:\n"
 		<< "-PCG <Path> : path of the PCG file to open\n"
+		<< "-Batch <Path> : converts many PCG files instead of -PCG: a folder containing .pcg files, or a text file listing one PCG path per line. Each PCG is exported to a subfolder of the destination folder\n"
 		<< "-OutFolder <Path> : path of the destination folder\n"
 		<< "-Combi <Letters> : combis to export (max:4). Ex: -Combi A C D M\n"
 		<< "-Program <Letters> : programs to export (max:4). Ex: -Program B D J\n"
+		<< "[-Stats <Path>] : prints the time spent in each conversion phase, and saves it as json to <Path> (optional)\n"
+		<< "[-Threads <Count>] : number of worker threads used for the conversion (optional, default:1, max:" << kMaxThreads << "). With -Batch, number of PCG files converted at the same time\n"
 		<< "[-unit_test] : performs unit test (optional)\n";
 }
 
+bool writeStats(const std::string& statsPath, const PCG_Converter::PhaseReport& report)
+{
+	std::cout << "\n";
+	PCG_Converter::writePhaseReport(std::cout, report);
+
+	std::ofstream statsFile(statsPath);
+	if (!statsFile.is_open())
+	{
+		std::cerr << "Can't write stats file \"" << statsPath << "\"!\n";
+		return false;
+	}
+
+	PCG_Converter::writePhaseReportJson(statsFile, report);
+	return true;
+}
+
+void convertSelection(PCG_Converter& converter, const std::vector<std::string>& programs, const std::vector<std::string>& combis)
+{
+	auto process = [](auto& selected, auto&& func)
+	{
+		if (!selected.empty())
+		{
+			int currentUserBank = 0;
+
+			std::vector<std::string> letters;
+			std::vector<int> targetIds;
+			for (auto& arg : selected)
+			{
+				letters.push_back(arg);
+				targetIds.push_back(currentUserBank);
+				currentUserBank++;
+			}
+			func(letters, targetIds);
+		}
+	};
+
+	process(programs, [&](const auto& letters, const auto& targets) { converter.convertPrograms(letters, targets); });
+	process(combis, [&](const auto& letters, const auto& targets) { converter.convertCombis(letters, targets); });
+}
+
+std::vector<std::filesystem::path> listBatchInputs(const std::filesystem::path& batchPath)
+{
+	std::vector<std::filesystem::path> inputs;
+
+	if (std::filesystem::is_directory(batchPath))
+	{
+		for (auto& entry : std::filesystem::directory_iterator(batchPath))
+		{
+			auto ext = entry.path().extension().string();
+			std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+			if (entry.is_regular_file() && ext == ".pcg")
+				inputs.push_back(entry.path());
+		}
+		std::sort(inputs.begin(), inputs.end());
+	}
+	else
+	{
+		// Manifest: one PCG path per line, relative paths are relative to the manifest
+		std::ifstream manifest(batchPath);
+		std::string line;
+		while (std::getline(manifest, line))
+		{
+			line.erase(line.find_last_not_of(" \t\r") + 1);
+			if (line.empty() || line[0] == '#')
+				continue;
+
+			std::filesystem::path input(line);
+			if (input.is_relative())
+				input = batchPath.parent_path() / input;
+			inputs.push_back(input);
+		}
+	}
+
+	return inputs;
+}
+
+// Templates, GM data and factory PCGs are loaded once per model, then shared by the converters of all files
+int convertBatch(const std::filesystem::path& batchPath, const std::filesystem::path& destFolder, uint32_t threadCount,
+	const std::vector<std::string>& programs, const std::vector<std::string>& combis, PCG_Converter::PhaseReport& out_report)
+{
+	auto inputs = listBatchInputs(batchPath);
+	if (inputs.empty())
+	{
+		std::cerr << "No PCG file found for batch conversion!\n";
+		return -1;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(destFolder, ec);
+
+	struct Core
+	{
+		KorgPCG* pcg = nullptr;
+		std::unique_ptr<PCG_Converter> converter;
+	};
+	std::map<EnumKorgModel, Core> cores;
+	std::mutex coresMutex;
+	std::mutex outputMutex;
+
+	std::atomic<size_t> nextInput = 0;
+	std::atomic<int> failures = 0;
+
+	auto convertFile = [&](const std::filesystem::path& pcgPath)
+	{
+		std::string output;
+		auto logFunc = [&output](const std::string& text) { output += text; };
+
+		EnumKorgModel model;
+		auto* pcg = LoadTritonPCG(pcgPath.string().c_str(), model);
+		if (!pcg)
+		{
+			failures++;
+			std::lock_guard<std::mutex> lock(outputMutex);
+			std::cerr << "Skipping \"" << pcgPath.string() << "\": PCG file is invalid or corrupted!\n";
+			return;
+		}
+
+		bool keepPCG = false;
+		const PCG_Converter* core = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(coresMutex);
+			auto& entry = cores[model];
+			if (!entry.converter)
+			{
+				// The first PCG of each model builds the core, and has to outlive it
+				entry.pcg = pcg;
+				entry.converter = std::make_unique<PCG_Converter>(model, pcg, destFolder.string());
+				keepPCG = true;
+			}
+			core = entry.converter.get();
+		}
+
+		PCG_Converter converter(*core, pcg, (destFolder / pcgPath.stem()).string(), logFunc);
+		if (converter.isInitialized())
+			convertSelection(converter, programs, combis);
+		else
+			failures++;
+
+		if (!keepPCG)
+			DeleteKorgPCG(pcg);
+
+		std::lock_guard<std::mutex> lock(outputMutex);
+		PCG_Converter::addPhaseReport(out_report, converter.getPhaseReport());
+		std::cout << "[" << pcgPath.filename().string() << "]\n" << output;
+	};
+
+	auto work = [&]()
+	{
+		for (size_t i = nextInput++; i < inputs.size(); i = nextInput++)
+			convertFile(inputs[i]);
+	};
+
+	threadCount = std::max<uint32_t>(1, std::min<uint32_t>(threadCount, (uint32_t)inputs.size()));
+	std::vector<std::thread> threads;
+	for (uint32_t i = 1; i < threadCount; i++)
+		threads.emplace_back(work);
+	work();
+	for (auto& thread : threads)
+		thread.join();
+
+	for (auto& [model, core] : cores)
+	{
+		PCG_Converter::addPhaseReport(out_report, core.converter->getPhaseReport());
+		core.converter.reset();
+		DeleteKorgPCG(core.pcg);
+	}
+
+	return failures > 0 ? -1 : 0;
+}
+
 int main(int argc, const char* argv[])
 {
 	const char* kCombi = "-Combi";
 	const char* kProgram = "-Program";
 	const char* kPCG = "-PCG";
+	const char* kBatch = "-Batch";
 	const char* kOutFolder = "-OutFolder";
+	const char* kThreads = "-Threads";
+	const char* kStats = "-Stats";
 	const char* kUnitTestArg = "-unit_test";
 
 	std::vector<std::string> args(argv + 1, argv + argc);
@@ -59,7 +258,10 @@ int main(int argc, const char* argv[])
 		{ kCombi, kCombi },
 		{ kProgram, kProgram },
 		{ kPCG, kPCG },
+		{ kBatch, kBatch },
 		{ kOutFolder, kOutFolder },
+		{ kThreads, kThreads },
+		{ kStats, kStats },
 		{ kUnitTestArg, kUnitTestArg }
 	};
 
@@ -76,7 +278,9 @@ int main(int argc, const char* argv[])
 		return 0;
 	}
 
-	if ((result.find(kPCG) == result.end() || result[kPCG].empty()))
+	const bool isBatch = (result.find(kBatch) != result.end() && !result[kBatch].empty());
+
+	if (!isBatch && (result.find(kPCG) == result.end() || result[kPCG].empty()))
 	{
 		std::cerr << "Please enter the path of a PCG file to read!\n";
 		printUsage();
@@ -106,9 +310,42 @@ int main(int argc, const char* argv[])
 
 	auto& programsToExport = result[kProgram];
 	auto& combisToExport = result[kCombi];
-	auto& pcgPath = result[kPCG][0];
 	auto& destFolder = result[kOutFolder][0];
 
+	uint32_t threadCount = 1;
+	if (result.find(kThreads) != result.end() && !result[kThreads].empty() && !parseThreadCount(result[kThreads][0], threadCount))
+	{
+		std::cerr << "Invalid thread count \"" << result[kThreads][0] << "\": it must be a number between 1 and " << kMaxThreads << "!\n";
+		printUsage();
+		return -1;
+	}
+
+	std::string statsPath;
+	if (result.find(kStats) != result.end() && !result[kStats].empty())
+	{
+		statsPath = result[kStats][0];
+		PCG_Converter::setInstrumentation(true);
+	}
+
+	if (isBatch)
+	{
+		auto& batchPath = result[kBatch][0];
+		if (!std::filesystem::exists(batchPath))
+		{
+			std::cerr << "Batch folder or manifest doesn't exist on disk!\n";
+			return -1;
+		}
+
+		PCG_Converter::PhaseReport report = {};
+		auto ret = convertBatch(batchPath, destFolder, threadCount, programsToExport, combisToExport, report);
+		if (!statsPath.empty() && !writeStats(statsPath, report))
+			return -1;
+
+		return ret;
+	}
+
+	auto& pcgPath = result[kPCG][0];
+
 	if (!std::filesystem::exists(pcgPath))
 	{
 		std::cerr << "Input PCG file doesn't exist on disk!\n";
@@ -129,26 +366,12 @@ int main(int argc, const char* argv[])
 		pcg,
 		destFolder);
 
-	auto process = [](auto& selected, auto&& func)
-	{
-		if (!selected.empty())
-		{
-			int currentUserBank = 0;
+	converter.setWorkerCount(threadCount);
 
-			std::vector<std::string> letters;
-			std::vector<int> targetIds;
-			for (auto& arg : selected)
-			{
-				letters.push_back(arg);
-				targetIds.push_back(currentUserBank);
-				currentUserBank++;
-			}
-			func(letters, targetIds);
-		}
-	};
+	convertSelection(converter, programsToExport, combisToExport);
 
-	process(result[kProgram], [&](const auto& letters, const auto& targets) { converter.convertPrograms(letters, targets); });
-	process(result[kCombi], [&](const auto& letters, const auto& targets) { converter.convertCombis(letters, targets); });
+	if (!statsPath.empty() && !writeStats(statsPath, converter.getPhaseReport()))
+		return -1;
 
 	return 0;
 }
@@ -1,6 +1,18 @@
 #include "alchemist.h"
 
 #include <cstring>
+#include <mutex>
+#include <new>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 constexpr const int kKorgHeaderSize = 16;
 unsigned char TritonPCGHeader[kKorgHeaderSize]			= { 'K', 'O', 'R', 'G', 0x50, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -28,13 +40,14 @@ unsigned long Read32(unsigned char* s) {
 	return ret |= *s;
 }
 
-void InitChunk(Chunk* chunk) {
+/* Splits chunk into its child chunks, down to depth levels */
+static void WalkChunk(Chunk* chunk, unsigned long depth) {
 	unsigned char* ptr;
 	unsigned long l, size, count;
 	unsigned char ok;
 	Chunk* c;
 
-	if (chunk) {
+	if (chunk && depth) {
 		l = chunk->size;
 		ptr = chunk->data;
 		ok = 1;
@@ -69,7 +82,7 @@ void InitChunk(Chunk* chunk) {
 				ptr += 4;
 				c->data = ptr;
 				ptr += c->size;
-				InitChunk(c);
+				WalkChunk(c, depth - 1);
 				c->size = c->size;
 				c->headersize = 0;
 			}
@@ -77,16 +90,21 @@ void InitChunk(Chunk* chunk) {
 	}
 }
 
+void InitChunk(Chunk* chunk) {
+	WalkChunk(chunk, (unsigned long)-1);
+}
+
 void InitKorgItem(KorgItem* item, unsigned long recordsize) {
 	if (item) {
 		item->recordsize = recordsize;
+		item->dataowner = 1;
 		item->data = (unsigned char*)malloc(recordsize);
 	}
 }
 
 void DeleteKorgItem(KorgItem* item) {
 	if (item) {
-		if (item->data) {
+		if (item->dataowner && item->data) {
 			free(item->data);
 			item->data = NULL;
 		}
@@ -132,7 +150,7 @@ void AddKorgBank(KorgBanks* banks, KorgBank* bank) {
 
 void DeleteKorgBlock(KorgBlock* block) {
 	if (block) {
-		if (block->data) {
+		if (block->dataowner && block->data) {
 			free(block->data);
 			block->data = NULL;
 		}
@@ -166,6 +184,12 @@ void DeleteKorgBanks(KorgBanks* banks) {
 }
 
 void DeleteKorgPCG(KorgPCG* PCG) {
+	if (PCG && PCG->arena) {
+		/* the PCG is the first allocation of its own arena */
+		UnmapKorgFile(PCG->file);
+		free(PCG->arena);
+		return;
+	}
 	if (PCG) {
 		DeleteKorgBanks(PCG->Arpeggio);
 		DeleteKorgBanks(PCG->Combination);
@@ -176,6 +200,7 @@ void DeleteKorgPCG(KorgPCG* PCG) {
 		DeleteKorgBlock(PCG->CSM1);
 		DeleteKorgBlock(PCG->DIV1);
 		DeleteKorgBlock(PCG->Global);
+		UnmapKorgFile(PCG->file);
 		free(PCG);
 		PCG = NULL;
 	}
@@ -204,6 +229,7 @@ KorgItem* CreateKorgItem(unsigned long recordsize, unsigned long size, const uns
 
 void InitKorgBlock(KorgBlock* block, Quad quad, unsigned long recordsize) {
 	if (block) {
+		block->dataowner = 1;
 		block->data = (unsigned char*)malloc(recordsize);
 		block->quad = quad;
 		block->recordsize = recordsize;
@@ -228,6 +254,8 @@ KorgBank* CreateKorgBank(Quad quad, unsigned long bank, unsigned long count, uns
 	unsigned long l;
 	KorgBank* newbank = (KorgBank*)malloc(sizeof(KorgBank));
 	if (newbank) {
+		new (newbank) KorgBank();
+		newbank->materialized = true;
 		if ((newbank->item = (KorgItem**)calloc(count, sizeof(KorgItem*))) != NULL) {
 			newbank->quad = quad;
 			newbank->count = count;
@@ -251,22 +279,344 @@ KorgBank* CreateKorgBank(Quad quad, unsigned long bank, unsigned long count, uns
 	return newbank;
 }
 
+KorgMappedFile* MapKorgFile(const char* file) {
+	KorgMappedFile* mapped = (KorgMappedFile*)calloc(1, sizeof(KorgMappedFile));
+	if (!mapped)
+		return NULL;
 
-KorgPCG* LoadTritonPCG(const char* file, EnumKorgModel& out_model) {
+#ifdef _WIN32
+	LARGE_INTEGER filesize;
+	HANDLE filehandle = CreateFileA(file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (filehandle == INVALID_HANDLE_VALUE) {
+		free(mapped);
+		return NULL;
+	}
+	mapped->filehandle = filehandle;
+
+	if (!GetFileSizeEx(filehandle, &filesize) || filesize.QuadPart == 0 || filesize.HighPart) {
+		UnmapKorgFile(mapped);
+		return NULL;
+	}
+	mapped->size = (unsigned long)filesize.QuadPart;
+
+	/* PAGE_WRITECOPY: item data is read only (see KorgItem), a stray write still can't reach the file */
+	mapped->maphandle = CreateFileMappingA(filehandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	if (!mapped->maphandle) {
+		UnmapKorgFile(mapped);
+		return NULL;
+	}
+
+	mapped->data = (unsigned char*)MapViewOfFile(mapped->maphandle, FILE_MAP_COPY, 0, 0, 0);
+	if (!mapped->data) {
+		UnmapKorgFile(mapped);
+		return NULL;
+	}
+#else
+	struct stat st;
+	void* view;
+	int fd = open(file, O_RDONLY);
+	if (fd < 0) {
+		free(mapped);
+		return NULL;
+	}
+
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		free(mapped);
+		return NULL;
+	}
+	mapped->size = (unsigned long)st.st_size;
+
+	/* MAP_PRIVATE: item data is read only (see KorgItem), a stray write still can't reach the file */
+	view = mmap(NULL, mapped->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED) {
+		free(mapped);
+		return NULL;
+	}
+	mapped->data = (unsigned char*)view;
+#endif
+
+	return mapped;
+}
+
+void UnmapKorgFile(KorgMappedFile* mapped) {
+	if (mapped && mapped->dataowner) {
+		free(mapped->data);
+		free(mapped);
+		return;
+	}
+	if (mapped) {
+#ifdef _WIN32
+		if (mapped->data)
+			UnmapViewOfFile(mapped->data);
+		if (mapped->maphandle)
+			CloseHandle(mapped->maphandle);
+		if (mapped->filehandle)
+			CloseHandle(mapped->filehandle);
+#else
+		if (mapped->data)
+			munmap(mapped->data, mapped->size);
+#endif
+		free(mapped);
+		mapped = NULL;
+	}
+}
+
+
+constexpr const unsigned long kKorgArenaAlign = 16;
+
+typedef struct {
+	unsigned char* base;
+	unsigned long size;
+	unsigned long used;
+} KorgArena;
+
+static unsigned long ArenaSize(unsigned long size) {
+	return (size + kKorgArenaAlign - 1) & ~(kKorgArenaAlign - 1);
+}
+
+/* Overflow checked sum of arena sizes: unsigned long is only 32 bits on Windows. 0 on overflow */
+static int ArenaSizeAdd(unsigned long* total, unsigned long size) {
+	if (size > (unsigned long)-1 - *total)
+		return 0;
+	*total += size;
+	return 1;
+}
+
+/* NULL when the arena is too small */
+static void* ArenaAlloc(KorgArena* arena, unsigned long size) {
+	void* ptr;
+	unsigned long available = arena->size - arena->used;
+	if (size > available || ArenaSize(size) < size || ArenaSize(size) > available)
+		return NULL;
+	size = ArenaSize(size);
+	ptr = arena->base + arena->used;
+	arena->used += size;
+	return ptr;
+}
+
+int KorgBankSlot(unsigned long bankId) {
+	if (bankId <= 0x0004)
+		return (int)bankId;
+	if (bankId == 0x8000)
+		return 5;
+	if (bankId >= 0xF0000 && bankId <= 0xF000A)
+		return 6 + (int)(bankId - 0xF0000);
+	if (bankId >= 0x20000 && bankId <= 0x20006)
+		return 17 + (int)(bankId - 0x20000);
+	return -1;
+}
+
+/* Index of the KorgPCG banks filled by a bank chunk, -1 if quad is not a bank */
+static int KorgBanksIndex(Quad quad) {
+	if (!QuadCmp(quad, QUAD_PBK1))
+		return 0;
+	if (!QuadCmp(quad, QUAD_MBK1))
+		return 1;
+	if (!QuadCmp(quad, QUAD_CBK1))
+		return 2;
+	if (!QuadCmp(quad, QUAD_DBK1))
+		return 3;
+	if (!QuadCmp(quad, QUAD_ABK1))
+		return 4;
+	return -1;
+}
+
+static KorgBanks** KorgBanksPtr(KorgPCG* PCG, int index) {
+	switch (index) {
+	case 0: return &PCG->Program;
+	case 1: return &PCG->MOSS;
+	case 2: return &PCG->Combination;
+	case 3: return &PCG->Drumkit;
+	default: return &PCG->Arpeggio;
+	}
+}
+
+static int IsKorgBankContainer(Quad quad) {
+	return !QuadCmp(quad, QUAD_PRG1) || !QuadCmp(quad, QUAD_CMB1) || !QuadCmp(quad, QUAD_DKT1) || !QuadCmp(quad, QUAD_ARP1);
+}
+
+static int IsKorgBlock(Quad quad) {
+	return !QuadCmp(quad, QUAD_CSM1) || !QuadCmp(quad, QUAD_DIV1) || !QuadCmp(quad, QUAD_GLB1);
+}
+
+/* Records that a bank chunk of size bytes holds, the last one may be partial */
+static unsigned long KorgBankRecordCount(unsigned long recordsize, unsigned long size) {
+	return recordsize ? size / recordsize + (size % recordsize ? 1 : 0) : 0;
+}
+
+/* Records of a bank chunk that are not complete in the file: they get a zero padded copy. At most 1 in a valid bank */
+static unsigned long KorgBankTruncatedCount(unsigned long count, unsigned long recordsize, unsigned long size) {
+	unsigned long complete = recordsize ? size / recordsize : count;
+	return complete < count ? count - complete : 0;
+}
+
+/* Overflow checked arena size of count elements of size bytes. 0 on overflow */
+static int ArenaSizeMul(unsigned long count, unsigned long size, unsigned long* out_size) {
+	if (size && count > ((unsigned long)-1 - (kKorgArenaAlign - 1)) / size)
+		return 0;
+	*out_size = ArenaSize(count * size);
+	return 1;
+}
+
+/* Arena bytes reserved for the items of a lazy bank: item pointers, items, then the padded copies. 0 on overflow */
+static int KorgBankReservedSize(unsigned long count, unsigned long recordsize, unsigned long size, unsigned long* out_size) {
+	unsigned long itemptrs, items, padded;
+	if (!ArenaSizeMul(count, sizeof(KorgItem*), &itemptrs) || !ArenaSizeMul(count, sizeof(KorgItem), &items)
+		|| !ArenaSizeMul(KorgBankTruncatedCount(count, recordsize, size), recordsize, &padded))
+		return 0;
+
+	*out_size = itemptrs;
+	return ArenaSizeAdd(out_size, items) && ArenaSizeAdd(out_size, padded);
+}
+
+/* Count, record size and bank id of a bank chunk. The records follow them.
+   0 when the chunk is too short for them, or holds fewer records than count */
+static int ReadKorgBankHeader(const Chunk* chunk, unsigned long* count, unsigned long* recordsize, unsigned long* bank) {
+	if (chunk->size < 12)
+		return 0;
+	*count = Read32(chunk->data);
+	*recordsize = Read32(chunk->data + 4);
+	*bank = Read32(chunk->data + 8);
+	return *count <= KorgBankRecordCount(*recordsize, chunk->size - 12);
+}
+
+/* Arena bytes needed by the PCG graph of root, and number of valid banks of each kind. 0 on overflow */
+static unsigned long SizeKorgPCG(const Chunk* root, unsigned long bankcounts[5]) {
+	unsigned long total = ArenaSize(sizeof(KorgPCG));
+	unsigned long l1, l2, k;
+	const Chunk* c1, * c2;
+
+	for (l1 = 0, c1 = root->childs; l1 < root->childcount; l1++, c1++) {
+		if (IsKorgBankContainer(c1->quad)) {
+			for (l2 = 0, c2 = c1->childs; l2 < c1->childcount; l2++, c2++) {
+				int index = KorgBanksIndex(c2->quad);
+				unsigned long number, recordsize, bank, reserved;
+				if (index >= 0 && ReadKorgBankHeader(c2, &number, &recordsize, &bank)) {
+					bankcounts[index]++;
+					if (!KorgBankReservedSize(number, recordsize, c2->size - 12, &reserved)
+						|| !ArenaSizeAdd(&total, ArenaSize(sizeof(KorgBank))) || !ArenaSizeAdd(&total, reserved))
+						return 0;
+				}
+			}
+		}
+		else if (IsKorgBlock(c1->quad) && !c1->childcount) {
+			if (!ArenaSizeAdd(&total, ArenaSize(sizeof(KorgBlock))))
+				return 0;
+		}
+	}
+
+	/* bankcounts are bounded by the chunk count, their products can't overflow */
+	for (k = 0; k < 5; k++)
+		if (bankcounts[k] && !ArenaSizeAdd(&total, ArenaSize(sizeof(KorgBanks)) + ArenaSize(bankcounts[k] * sizeof(KorgBank*))))
+			return 0;
+	return total;
+}
+
+/* Only reserves the arena space of the items: they are built by MaterializeKorgBank. NULL when the arena is too small */
+static KorgBank* ArenaCreateKorgBank(KorgArena* arena, Quad quad, unsigned long bank, unsigned long count, unsigned long recordsize, unsigned long size, unsigned char* data) {
+	unsigned long reserved;
+	void* space = ArenaAlloc(arena, sizeof(KorgBank));
+	if (!space)
+		return NULL;
+
+	KorgBank* newbank = new (space) KorgBank();
+	newbank->quad = quad;
+	newbank->count = count;
+	newbank->recordsize = recordsize;
+	newbank->bank = bank;
+	newbank->source = data;
+	newbank->sourcesize = size;
+	if (!KorgBankReservedSize(count, recordsize, size, &reserved))
+		return NULL;
+
+	newbank->reserved = (unsigned char*)ArenaAlloc(arena, reserved);
+	return newbank->reserved ? newbank : NULL;
+}
+
+static std::mutex KorgMaterializeMutex;
+
+KorgItem** MaterializeKorgBank(KorgBank* bank) {
+	if (bank->materialized.load(std::memory_order_acquire))
+		return bank->item;
+
+	std::lock_guard<std::mutex> lock(KorgMaterializeMutex);
+	if (!bank->materialized.load(std::memory_order_relaxed)) {
+		unsigned long l;
+		unsigned long size = bank->sourcesize;
+		unsigned char* data = bank->source;
+		KorgItem** itemptrs = (KorgItem**)bank->reserved;
+		KorgItem* items = (KorgItem*)(bank->reserved + ArenaSize(bank->count * sizeof(KorgItem*)));
+		unsigned char* padded = (unsigned char*)items + ArenaSize(bank->count * sizeof(KorgItem));
+
+		for (l = 0; l < bank->count; l++) {
+			KorgItem* item = &items[l];
+			item->recordsize = bank->recordsize;
+			item->dataowner = 0;
+			if (size >= bank->recordsize)
+				item->data = data;
+			else {
+				item->data = padded;
+				memcpy(item->data, data, size);
+				memset(item->data + size, 0, bank->recordsize - size);
+				padded += ArenaSize(bank->recordsize);
+			}
+			itemptrs[l] = item;
+			if (size > bank->recordsize)
+				size -= bank->recordsize;
+			else
+				size = 0;
+			data += bank->recordsize;
+		}
+
+		bank->item = itemptrs;
+		bank->materialized.store(true, std::memory_order_release);
+	}
+	return bank->item;
+}
+
+KorgItem* GetKorgItem(KorgBank* bank, unsigned long index) {
+	if (!bank || index >= bank->count)
+		return NULL;
+	return MaterializeKorgBank(bank)[index];
+}
+
+/* NULL when the arena is too small */
+static KorgBlock* ArenaCreateKorgBlock(KorgArena* arena, Quad quad, unsigned long recordsize, unsigned char* data) {
+	KorgBlock* newblock = (KorgBlock*)ArenaAlloc(arena, sizeof(KorgBlock));
+	if (!newblock)
+		return NULL;
+	newblock->quad = quad;
+	newblock->recordsize = recordsize;
+	newblock->dataowner = 0;
+	newblock->data = data;
+	return newblock;
+}
+
+/* The arena doesn't match the chunk headers: they are corrupted */
+static KorgPCG* FailArenaTritonPCG(const char* file, unsigned char* arenabase, Chunk* root) {
+	fprintf(stderr, "Input file \"%s\" is not a valid PCG (bad bank sizes).\n", file);
+	free(arenabase);
+	DestroyChunk(root);
+	return NULL;
+}
+
+/* Builds the PCG tree over buffer: items point straight into it, so it must outlive the result */
+static KorgPCG* ParseTritonPCG(const char* file, unsigned char* buffer, unsigned long buflen, EnumKorgModel& out_model) {
 	KorgPCG* PCG = NULL;
-	FILE* infile;
 	Chunk PCGChunk, * c1;
-	unsigned long l, buflen, l1;
+	KorgArena arena;
+	unsigned long bankcounts[5];
+	unsigned long l1, k;
 
-	auto success = infile = fopen(file, "rb");
-	if (!infile) {
-		fprintf(stderr, "File not found: \"%s\".\n", file);
+	if (buflen < kKorgHeaderSize + 8) {
+		fprintf(stderr, "Input file \"%s\" is not a valid Triton PCG (bad header).\n", file);
 		return NULL;
 	}
 
 	/* reading the header */
-	unsigned char filehead[kKorgHeaderSize];
-	fread(filehead, kKorgHeaderSize, 1, infile);
+	unsigned char* filehead = buffer;
 
 	if (memcmp(filehead, TritonPCGHeader, kKorgHeaderSize) == 0)
 	{
@@ -287,86 +637,108 @@ KorgPCG* LoadTritonPCG(const char* file, EnumKorgModel& out_model) {
 	else
 	{
 		fprintf(stderr, "Input file \"%s\" is not a valid Triton PCG (bad header).\n", file);
-		fclose(infile);
 		return NULL;
 	}
 
 	memset(&PCGChunk, 0, sizeof(Chunk));
 
-	fread(&PCGChunk.quad, sizeof(Quad), 1, infile);
+	memcpy(&PCGChunk.quad, buffer + kKorgHeaderSize, sizeof(Quad));
 	if (QuadCmp(PCGChunk.quad, QUAD_PCG1)) {
 		fprintf(stderr, "Input file \"%s\" is not a valid PCG (bad root chunk).\n", file);
-		fclose(infile);
 		return NULL;
 	}
 
-	PCGChunk.size = fRead32(infile);
-	PCGChunk.size = PCGChunk.size;
+	PCGChunk.size = Read32(buffer + kKorgHeaderSize + 4);
 
-	l = ftell(infile);
-	fseek(infile, 0, SEEK_END);
-	buflen = ftell(infile) - l;
-	fseek(infile, l, SEEK_SET);
+	buffer += kKorgHeaderSize + 8;
+	buflen -= kKorgHeaderSize + 8;
 
 	if (PCGChunk.size != buflen) {
 		fprintf(stderr, "Input file \"%s\" is not a valid PCG (incorrect size).\n", file);
-		fclose(infile);
 		return NULL;
 	}
 
-	PCGChunk.data = (unsigned char*)malloc(buflen);
-	PCGChunk.dataowner = 1;
-	fread(PCGChunk.data, PCGChunk.size, 1, infile);
+	PCGChunk.data = buffer;
+	PCGChunk.dataowner = 0;
 
-	InitChunk(&PCGChunk);
+	/* PCG1 > PRG1/CMB1/... > PBK1/CBK1/...: the records inside the banks are not walked */
+	WalkChunk(&PCGChunk, 2);
 
 	if (!PCGChunk.childcount) {
 		fprintf(stderr, "Input file \"%s\" is not a valid PCG (empty PCG?).\n", file);
 		DestroyChunk(&PCGChunk);
-		fclose(infile);
 		return NULL;
 	}
 
-	PCG = CreateKorgPCG(out_model);
+	/* the whole graph goes into one allocation, sized from the chunk headers */
+	memset(bankcounts, 0, sizeof(bankcounts));
+	arena.size = SizeKorgPCG(&PCGChunk, bankcounts);
+	arena.used = 0;
+	if (!arena.size)
+		return FailArenaTritonPCG(file, NULL, &PCGChunk);
+
+	arena.base = (unsigned char*)calloc(1, arena.size);
+	if (!arena.base) {
+		fprintf(stderr, "Input file \"%s\": out of memory.\n", file);
+		DestroyChunk(&PCGChunk);
+		return NULL;
+	}
+
+	PCG = (KorgPCG*)ArenaAlloc(&arena, sizeof(KorgPCG));
+	if (!PCG)
+		return FailArenaTritonPCG(file, arena.base, &PCGChunk);
+	PCG->model = out_model;
+	PCG->arena = arena.base;
+
+	for (k = 0; k < 5; k++) {
+		if (bankcounts[k]) {
+			KorgBanks* banks = (KorgBanks*)ArenaAlloc(&arena, sizeof(KorgBanks));
+			if (!banks)
+				return FailArenaTritonPCG(file, arena.base, &PCGChunk);
+			banks->bank = (KorgBank**)ArenaAlloc(&arena, bankcounts[k] * sizeof(KorgBank*));
+			if (!banks->bank)
+				return FailArenaTritonPCG(file, arena.base, &PCGChunk);
+			*KorgBanksPtr(PCG, k) = banks;
+		}
+	}
 
 	/* Parsing PCG1 */
 	for (l1 = 0, c1 = PCGChunk.childs; l1 < PCGChunk.childcount; l1++, c1++) {
-		if (!QuadCmp(c1->quad, QUAD_PRG1) || !QuadCmp(c1->quad, QUAD_CMB1) || !QuadCmp(c1->quad, QUAD_DKT1) || !QuadCmp(c1->quad, QUAD_ARP1)) {
+		if (IsKorgBankContainer(c1->quad)) {
 			if (c1->childcount) {
 				/* PRG1, CMB1, DKT1, ARP1: bank containers */
 				Chunk* c2;
 				unsigned long l2;
 				for (l2 = 0, c2 = c1->childs; l2 < c1->childcount; l2++, c2++) {
 					/* reading each bank */
-					KorgBanks** banksptr;
-					if (!QuadCmp(c2->quad, QUAD_PBK1) || !QuadCmp(c2->quad, QUAD_MBK1) || !QuadCmp(c2->quad, QUAD_CBK1) || !QuadCmp(c2->quad, QUAD_DBK1) || !QuadCmp(c2->quad, QUAD_ABK1)) {
+					int index = KorgBanksIndex(c2->quad);
+					unsigned long number, size, bank;
+					if (index >= 0 && !ReadKorgBankHeader(c2, &number, &size, &bank)) {
+						fprintf(stderr, "[%c%c%c%c] Invalid bank \"%c%c%c%c\"\n", c1->quad.data[0], c1->quad.data[1], c1->quad.data[2], c1->quad.data[3], c2->quad.data[0], c2->quad.data[1], c2->quad.data[2], c2->quad.data[3]);
+					}
+					else if (index >= 0) {
 						/* PBK1, MBK1, CBK1, DBK1, ABK1: banks */
-						unsigned long number, size, bank;
-						if (!QuadCmp(c2->quad, QUAD_PBK1))
-							banksptr = &PCG->Program;
-						else if (!QuadCmp(c2->quad, QUAD_MBK1))
-							banksptr = &PCG->MOSS;
-						else if (!QuadCmp(c2->quad, QUAD_CBK1))
-							banksptr = &PCG->Combination;
-						else if (!QuadCmp(c2->quad, QUAD_DBK1))
-							banksptr = &PCG->Drumkit;
-						else /* if (!QuadCmp(c2->quad, QUAD_ABK1)) */
-							banksptr = &PCG->Arpeggio;
-
-						if (!*banksptr)
-							*banksptr = CreateKorgBanks();
-
-						number = Read32(c2->data);
-						size = Read32(c2->data + 4);
-						bank = Read32(c2->data + 8);
-						AddKorgBank(*banksptr, CreateKorgBank(c2->quad, bank, number, size, c2->size - 12, c2->data + 12));
+						KorgBanks* banks = *KorgBanksPtr(PCG, index);
+						KorgBank* newbank;
+						int slot;
+
+						newbank = ArenaCreateKorgBank(&arena, c2->quad, bank, number, size, c2->size - 12, c2->data + 12);
+						if (!newbank)
+							return FailArenaTritonPCG(file, arena.base, &PCGChunk);
+						banks->bank[banks->count++] = newbank;
+
+						slot = KorgBankSlot(bank);
+						if (slot >= 0 && index == 0 && !PCG->ProgramSlots[slot])
+							PCG->ProgramSlots[slot] = newbank;
+						else if (slot >= 0 && index == 2 && !PCG->CombinationSlots[slot])
+							PCG->CombinationSlots[slot] = newbank;
 					}
 					else
 						fprintf(stderr, "[%c%c%c%c] Unknown QUAD \"%c%c%c%c\"\n", c1->quad.data[0], c1->quad.data[1], c1->quad.data[2], c1->quad.data[3], c2->quad.data[0], c2->quad.data[1], c2->quad.data[2], c2->quad.data[3]);
 				}
 			}
 		}
-		else if (!QuadCmp(c1->quad, QUAD_CSM1) || !QuadCmp(c1->quad, QUAD_DIV1) || !QuadCmp(c1->quad, QUAD_GLB1)) {
+		else if (IsKorgBlock(c1->quad)) {
 			if (!c1->childcount) {
 				/* CSM1, DIV1, GLB1: 1 item blocks */
 				KorgBlock** blockptr;
@@ -377,10 +749,9 @@ KorgPCG* LoadTritonPCG(const char* file, EnumKorgModel& out_model) {
 				else /* if (!QuadCmp(c1->quad, QUAD_GLB1)) */
 					blockptr = &PCG->Global;
 
-				if (*blockptr)
-					DeleteKorgBlock(*blockptr);
-
-				*blockptr = CreateKorgBlock(c1->quad, c1->size, c1->data);
+				*blockptr = ArenaCreateKorgBlock(&arena, c1->quad, c1->size, c1->data);
+				if (!*blockptr)
+					return FailArenaTritonPCG(file, arena.base, &PCGChunk);
 			}
 		}
 		else {
@@ -389,7 +760,61 @@ KorgPCG* LoadTritonPCG(const char* file, EnumKorgModel& out_model) {
 	}
 
 	DestroyChunk(&PCGChunk);
-	fclose(infile);
 
 	return PCG;
 }
+
+KorgPCG* LoadTritonPCG(const char* file, EnumKorgModel& out_model) {
+	KorgPCG* PCG;
+	KorgMappedFile* mapped = MapKorgFile(file);
+	if (!mapped) {
+		fprintf(stderr, "File not found: \"%s\".\n", file);
+		return NULL;
+	}
+
+	PCG = ParseTritonPCG(file, mapped->data, mapped->size, out_model);
+	if (!PCG) {
+		UnmapKorgFile(mapped);
+		return NULL;
+	}
+
+	PCG->file = mapped;
+	return PCG;
+}
+
+KorgPCG* LoadTritonPCGFromMemory(const uint8_t* buffer, size_t size, EnumKorgModel& out_model, bool copy) {
+	KorgPCG* PCG;
+	KorgMappedFile* owned;
+
+	if (!buffer || size > (unsigned long)-1) {
+		fprintf(stderr, "Input buffer is not a valid Triton PCG (bad size).\n");
+		return NULL;
+	}
+
+	if (!copy) {
+		/* item data is read only (see KorgItem): the buffer can be parsed in place */
+		return ParseTritonPCG("<memory>", (unsigned char*)buffer, (unsigned long)size, out_model);
+	}
+
+	owned = (KorgMappedFile*)calloc(1, sizeof(KorgMappedFile));
+	if (!owned)
+		return NULL;
+
+	owned->dataowner = 1;
+	owned->size = (unsigned long)size;
+	owned->data = (unsigned char*)malloc(size ? size : 1);
+	if (!owned->data) {
+		free(owned);
+		return NULL;
+	}
+	memcpy(owned->data, buffer, size);
+
+	PCG = ParseTritonPCG("<memory>", owned->data, owned->size, out_model);
+	if (!PCG) {
+		UnmapKorgFile(owned);
+		return NULL;
+	}
+
+	PCG->file = owned;
+	return PCG;
+}
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cstdint>
+#include <atomic>
 
 typedef char str16[16];
 typedef struct { char data[4]; } Quad;
@@ -28,23 +29,32 @@ enum class EnumKorgModel : uint8_t {
 	KORG_TRITON_LE
 };
 
+/* data is a heap copy when dataowner is set, otherwise it points into the mapped PCG file, the PCG arena or the caller's buffer.
+   Item data is read only: converters never write to it */
 typedef struct {
 	unsigned long recordsize;
+	unsigned char dataowner;
 	unsigned char* data;
 } KorgItem;
 
 typedef struct {
 	Quad quad;
 	unsigned long recordsize;
+	unsigned char dataowner;
 	unsigned char* data;
 } KorgBlock;
 
+/* Banks of a loaded PCG are lazy: their items are only built on first use, access them with GetKorgItem */
 struct KorgBank {
 	Quad quad;
 	unsigned long count;
 	unsigned long recordsize;
 	unsigned long bank;
 	KorgItem** item;
+	unsigned char* source; /* lazy banks: records in the PCG buffer */
+	unsigned long sourcesize;
+	unsigned char* reserved; /* lazy banks: PCG arena space for the items and the padded copies of truncated records */
+	std::atomic<bool> materialized;
 };
 
 typedef struct {
@@ -52,10 +62,33 @@ typedef struct {
 	KorgBank** bank;
 } KorgBanks;
 
+/* Banks A-E, F, GM and its 10 variations, H-N: the slot of a bank is its short id */
+const int kKorgBankSlots = 24;
+
+/* Slot of the bank id stored in a bank chunk, -1 if unknown */
+int KorgBankSlot(unsigned long bankId);
+
+/* Copy-on-write view of a whole PCG file, or a heap copy of a PCG buffer when dataowner is set */
+typedef struct KorgMappedFile {
+	unsigned char dataowner;
+	unsigned char* data;
+	unsigned long size;
+#ifdef _WIN32
+	void* filehandle;
+	void* maphandle;
+#endif
+} KorgMappedFile;
+
+KorgMappedFile* MapKorgFile(const char* file);
+void UnmapKorgFile(KorgMappedFile* mapped);
+
 struct KorgPCG {
 	EnumKorgModel model;
+	KorgMappedFile* file; /* Backs the items that are not data owners. NULL when the PCG borrows the caller's buffer */
+	unsigned char* arena; /* When set, the whole graph lives in this single allocation: only DeleteKorgPCG may free it */
 	KorgBanks* Arpeggio, * Combination, * Drumkit, * MOSS, * Program, * Prophecy;
 	KorgBlock* CSM1, * DIV1, * Global;
+	KorgBank* ProgramSlots[kKorgBankSlots], * CombinationSlots[kKorgBankSlots]; /* Filled by the loaders, NULL when the bank isn't stored */
 };
 
 const Quad QUAD_NONE = { { ' ', ' ', ' ', ' ' } };
@@ -94,4 +127,12 @@ KorgItem* CreateKorgItem(unsigned long recordsize, unsigned long size, const uns
 KorgBlock* CreateKorgBlock(Quad quad, unsigned long recordsize, const unsigned char* data);
 KorgBank* CreateKorgBank(Quad quad, unsigned long bank, unsigned long count, unsigned long recordsize, unsigned long size, const unsigned char* data);
 
+/* Builds the items of a lazy bank, thread safe. Returns bank->item */
+KorgItem** MaterializeKorgBank(KorgBank* bank);
+/* NULL when index is out of range */
+KorgItem* GetKorgItem(KorgBank* bank, unsigned long index);
+
 KorgPCG* LoadTritonPCG(const char* file, EnumKorgModel& out_model);
+/* Same as LoadTritonPCG, from a PCG file already in memory. With copy, buffer can be freed after the call.
+   Without copy, the items point into buffer: it must outlive the PCG, and is never written to */
+KorgPCG* LoadTritonPCGFromMemory(const uint8_t* buffer, size_t size, EnumKorgModel& out_model, bool copy = true);
@@ -0,0 +1,23 @@
+#include "embedded_resources.h"
+
+#include <cstring>
+
+#ifdef PCGTOVST_EMBED_RESOURCES
+extern const EmbeddedResource kEmbeddedResources[];
+extern const size_t kEmbeddedResourceCount;
+
+const EmbeddedResource* findEmbeddedResource(const std::string& name)
+{
+	for (size_t i = 0; i < kEmbeddedResourceCount; i++)
+	{
+		if (name == kEmbeddedResources[i].name)
+			return &kEmbeddedResources[i];
+	}
+	return nullptr;
+}
+#else
+const EmbeddedResource* findEmbeddedResource(const std::string&)
+{
+	return nullptr;
+}
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Resources baked into the executable when building with PCGTOVST_EMBED_RESOURCES.
+// The data is generated by cmake/EmbedResources.cmake from the Resources folder
+struct EmbeddedResource
+{
+	const char* name; // File name, without folder
+	const unsigned char* data;
+	size_t size;
+};
+
+// Returns nullptr when the resource isn't embedded (or when nothing is embedded): the Data folder is used instead
+const EmbeddedResource* findEmbeddedResource(const std::string& name);
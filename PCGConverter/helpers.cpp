@@ -7,6 +7,7 @@
 #include <assert.h>
 
 #include <filesystem>
+#include <unordered_map>
 
 #include "alchemist.h"
 
@@ -44,30 +45,56 @@ bool Helpers::isGMBank(int bankId)
 	return (bankId >= 6 && bankId <= 16);
 }
 
-std::string Helpers::pcgProgBankIdToLetter(int bankId)
+const BankDef* Helpers::findBankDefByShortId(int shortId)
 {
-	auto found = std::find_if(bank_definitions.begin(), bank_definitions.end(), [&bankId](auto& e) { return e.shortId == bankId; });
-	if (found != bank_definitions.end())
+	// bank_definitions is sorted by short id, which is also the PCG bank slot
+	if (shortId < 0 || shortId >= static_cast<int>(bank_definitions.size()))
+		return nullptr;
+
+	assert(bank_definitions[shortId].shortId == shortId);
+	return &bank_definitions[shortId];
+}
+
+const BankDef* Helpers::findBankDefByName(const std::string& name)
+{
+	static const auto byName = []()
+	{
+		std::unordered_map<std::string, const BankDef*> map;
+		for (auto& def : bank_definitions)
+			map.emplace(def.name, &def);
+		return map;
+	}();
+
+	auto found = byName.find(name);
+	return (found != byName.end()) ? found->second : nullptr;
+}
+
+static const std::string kUnknownBankLetter = "?";
+
+const std::string& Helpers::pcgProgBankIdToLetter(int bankId)
+{
+	if (auto* found = findBankDefByShortId(bankId))
 		return found->name;
 
 	assert(false && "Unknown bank Id");
-	return "?";
+	return kUnknownBankLetter;
 }
 
-std::string Helpers::bankIdToLetter(int bankId)
+const std::string& Helpers::bankIdToLetter(int bankId)
 {
-	auto found = std::find_if(bank_definitions.begin(), bank_definitions.end(), [&bankId](auto& e) { return e.hexId == bankId; });
-	if (found != bank_definitions.end())
+	if (auto* found = findBankDefByShortId(KorgBankSlot(bankId)))
+	{
+		assert(found->hexId == bankId);
 		return found->name;
+	}
 
 	assert(false && "Unknown bank Id");
-	return "?";
+	return kUnknownBankLetter;
 }
 
 int Helpers::bankPcgIdToId(int bankId)
 {
-	auto found = std::find_if(bank_definitions.begin(), bank_definitions.end(), [&bankId](auto& e) { return e.shortId == bankId; });
-	if (found != bank_definitions.end())
+	if (auto* found = findBankDefByShortId(bankId))
 	{
 		assert(found->regularId != -1);
 		return found->regularId;
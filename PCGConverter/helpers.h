@@ -35,8 +35,8 @@ enum class EPatchMode : uint8_t { Program, Combi };
 class Helpers
 {
 public:
-	static std::string bankIdToLetter(int bankId);
-	static std::string pcgProgBankIdToLetter(int bankId);
+	static const std::string& bankIdToLetter(int bankId);
+	static const std::string& pcgProgBankIdToLetter(int bankId);
 	static bool isGMBank(int bankId);
 	static int bankPcgIdToId(int bankId);
 
@@ -63,6 +63,10 @@ public:
 		return nullptr;
 	}
 
+	// Constant time lookups, nullptr when unknown
+	static const BankDef* findBankDefByShortId(int shortId);
+	static const BankDef* findBankDefByName(const std::string& name);
+
 private:
 	static std::vector<BankDef> bank_definitions;
 };
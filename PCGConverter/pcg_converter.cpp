@@ -1,6 +1,7 @@
 #include "pcg_converter.h"
 
 #include "alchemist.h"
+#include "embedded_resources.h"
 #include "helpers.h"
 
 #include <sstream>
@@ -8,7 +9,12 @@
 #include <filesystem>
 #include <iomanip>
 #include <array>
+#include <algorithm>
 #include <regex>
+#include <mutex>
+#include <condition_variable>
+#include <charconv>
+#include <cstring>
 
 #include "rapidjson/document.h"
 #include "rapidjson/istreamwrapper.h"
@@ -25,11 +31,10 @@
 
 
 std::vector<std::string> PCG_Converter::vst_bank_letters = { "A", "B", "C", "D" };
-std::map<std::string, int> PCG_Converter::m_mapProgram_keyToId;
-std::map<std::string, int> PCG_Converter::m_mapCombi_keyToId;
+std::mutex PCG_Converter::m_sharedResourcesMutex;
+std::shared_ptr<const PCG_Converter::ConverterResources> PCG_Converter::m_sharedResources;
 
-std::vector<char> PCG_Converter::m_gmData;
-std::vector<PCG_Converter::GMBankData> PCG_Converter::m_mappedGMInfo;
+std::atomic<bool> PCG_Converter::m_instrumented = false;
 
 const int CustomProgramBufferSize = 540;
 
@@ -43,16 +48,17 @@ PCG_Converter::PCG_Converter(
 	, m_destFolder(destFolder)
 	, m_logFunc(std::move(func))
 {
-	initEffectConversions();
-
-	if (!retrieveTemplatesData())
+	if (!retrieveResources())
 		return;
 
-	if (!retrieveGMData())
-		return;
+	m_dictProgParams.init(m_resources->programLayout);
+	m_dictCombiParams.init(m_resources->combiLayout);
 
-	if (!retrieveFactoryPCG())
-		return;
+	{
+		ScopedPhase phase(*this, EPhase::FactoryData);
+		if (!retrieveFactoryPCG())
+			return;
+	}
 
 	m_initialized = true;
 }
@@ -61,11 +67,39 @@ PCG_Converter::PCG_Converter(const PCG_Converter& other, const std::string destF
 	: m_pcg(other.m_pcg)
 	, m_targetModel(other.m_targetModel)
 	, m_destFolder(destFolder)
+	, m_resources(other.m_resources)
+	, m_printedWarnings(other.m_printedWarnings)
 {
 	m_dictProgParams = other.m_dictProgParams;
 	m_dictCombiParams = other.m_dictCombiParams;
 	m_factoryPcg = other.m_factoryPcg;
-	m_mappedGMInfo = other.m_mappedGMInfo;
+}
+
+PCG_Converter::PCG_Converter(
+	const PCG_Converter& core,
+	KorgPCG* pcg,
+	const std::string destFolder,
+	std::function<void(const std::string&)>&& func)
+	: m_pcg(pcg)
+	, m_targetModel(core.m_targetModel)
+	, m_destFolder(destFolder)
+	, m_logFunc(std::move(func))
+{
+	if (!core.m_initialized)
+		return;
+
+	// The factory PCG of the core only matches PCGs of the same model
+	if (pcg->model != core.m_pcg->model)
+	{
+		error("Critical error: PCG model doesn't match the one of the converter core!\n");
+		return;
+	}
+
+	m_resources = core.m_resources;
+	m_dictProgParams = core.m_dictProgParams;
+	m_dictCombiParams = core.m_dictCombiParams;
+	m_factoryPcg = core.m_factoryPcg;
+	m_initialized = true;
 }
 
 template<typename T>
@@ -103,149 +137,497 @@ fs::path getDataPath()
 #endif
 }
 
-bool PCG_Converter::retrieveTemplatesData()
+std::string PCG_Converter::getDataFolder()
 {
-	auto parse = [&](std::string filename, auto& target)
+	return getDataPath().string();
+}
+
+bool PCG_Converter::retrieveResources()
+{
+	// The first converter builds the resources, the others wait for it and share them
+	std::lock_guard<std::mutex> lock(m_sharedResourcesMutex);
+	if (!m_sharedResources)
 	{
-		auto filePath = getDataPath() / filename;
-		std::ifstream ifs(filePath);
-		if (!ifs.is_open())
+		auto resources = std::make_shared<ConverterResources>();
+
 		{
-			auto errMsg = "Critical error: Template" + filePath.string() + "not found!!\n";
-			error(errMsg);
-			return false;
+			ScopedPhase phase(*this, EPhase::Templates);
+			if (!retrieveTemplatesData(*resources))
+				return false;
+
+			resources->initConversionPlans();
 		}
-		else
+
 		{
-			rapidjson::IStreamWrapper refisw{ ifs };
-			target.ParseStream(refisw);
-			return true;
+			ScopedPhase phase(*this, EPhase::FactoryData);
+			if (!retrieveGMData(*resources))
+				return false;
 		}
-	};
 
-	rapidjson::Document templateProgDoc;
-	if (!parse("PatchTemplate_Program.patch", templateProgDoc))
-		return false;
+		m_sharedResources = std::move(resources);
+	}
 
-	rapidjson::Document templateCombiDoc;
-	if (!parse("PatchTemplate_Combi.patch", templateCombiDoc))
-		return false;
+	m_resources = m_sharedResources;
+	return true;
+}
 
-	static bool initIdMaps = true;
+PCG_Converter::ConverterResources::~ConverterResources()
+{
+	if (gmFile)
+		UnmapKorgFile(gmFile);
+}
 
-	auto getAllData = [](auto& doc, auto& out_dict, auto& out_map)
+bool PCG_Converter::retrieveTemplatesData(ConverterResources& out_resources)
+{
+	auto load = [&](std::string filename, ParamLayout& out_layout)
 	{
+		rapidjson::Document doc;
+		std::string cachePath;
+		auto filePath = getDataPath() / filename;
+
+		// Embedded templates are parsed in place, the cache would be slower than the parsing itself
+		if (auto* embedded = findEmbeddedResource(filename))
+		{
+			doc.Parse(reinterpret_cast<const char*>(embedded->data), embedded->size);
+		}
+		else
+		{
+			std::ifstream ifs(filePath);
+			if (!ifs.is_open())
+			{
+				auto errMsg = "Critical error: Template" + filePath.string() + "not found!!\n";
+				error(errMsg);
+				return false;
+			}
+
+			cachePath = filePath.string() + ".cache";
+			if (readTemplateCache(filePath.string(), cachePath, out_layout))
+				return true;
+
+			rapidjson::IStreamWrapper refisw{ ifs };
+			doc.ParseStream(refisw);
+		}
+
+		std::map<int, std::pair<std::string, int>> sortedParams;
+
 		auto dspSettings = doc["dsp_settings"].GetArray();
 		for (auto& setting : dspSettings)
 		{
 			auto key = setting["key"].GetString();
 			auto id = setting["index"].GetInt();
-			out_dict[id] = ProgParam(key, setting["value"].GetInt());
-			if (initIdMaps)
-				out_map[key] = id;
+			sortedParams[id] = { key, setting["value"].GetInt() };
 		}
+
+		for (auto& [id, param] : sortedParams)
+			out_layout.addParam(id, param.first, param.second);
+
+		if (!cachePath.empty())
+			writeTemplateCache(filePath.string(), cachePath, out_layout);
+		return true;
 	};
 
-	getAllData(templateProgDoc, m_dictProgParams, m_mapProgram_keyToId);
-	getAllData(templateCombiDoc, m_dictCombiParams, m_mapCombi_keyToId);
+	if (!load("PatchTemplate_Program.patch", out_resources.programLayout))
+		return false;
 
-	initIdMaps = false;
-	return true;
+	return load("PatchTemplate_Combi.patch", out_resources.combiLayout);
 }
 
-bool PCG_Converter::retrieveGMData()
+// Template cache: the params of a template, sorted by index, stored next to it.
+// It is rebuilt when the size or the modification time of the template changes
+namespace
 {
-	if (!m_mappedGMInfo.empty())
+	constexpr const char kTemplateCacheMagic[4] = { 'P', 'T', 'C', '1' };
+
+	struct TemplateCacheHeader
+	{
+		char magic[4];
+		uint32_t paramCount;
+		uint64_t templateSize;
+		int64_t templateTime;
+	};
+
+	struct TemplateCacheParam
+	{
+		int32_t id;
+		int32_t defaultValue;
+		uint32_t keySize; // Followed by the key characters
+	};
+
+	bool getTemplateStamp(const std::string& templatePath, uint64_t& out_size, int64_t& out_time)
+	{
+		std::error_code ec;
+		out_size = fs::file_size(templatePath, ec);
+		if (ec)
+			return false;
+
+		auto time = fs::last_write_time(templatePath, ec);
+		if (ec)
+			return false;
+
+		out_time = static_cast<int64_t>(time.time_since_epoch().count());
 		return true;
+	}
+}
+
+bool PCG_Converter::readTemplateCache(const std::string& templatePath, const std::string& cachePath, ParamLayout& out_layout)
+{
+	uint64_t templateSize;
+	int64_t templateTime;
+	if (!fs::exists(cachePath) || !getTemplateStamp(templatePath, templateSize, templateTime))
+		return false;
+
+	KorgMappedFile* mapped = MapKorgFile(cachePath.c_str());
+	if (!mapped)
+		return false;
+
+	const unsigned char* ptr = mapped->data;
+	const unsigned char* end = mapped->data + mapped->size;
+
+	TemplateCacheHeader header;
+	bool valid = (end - ptr >= (std::ptrdiff_t)sizeof(header));
+	if (valid)
+	{
+		memcpy(&header, ptr, sizeof(header));
+		ptr += sizeof(header);
+		valid = memcmp(header.magic, kTemplateCacheMagic, sizeof(header.magic)) == 0
+			&& header.templateSize == templateSize && header.templateTime == templateTime;
+	}
 
-	auto filePath = getDataPath() / "Factory_GM_Programs.bin";
-	std::ifstream file(filePath, std::ios::in | std::ios::binary | std::ios::ate);
-	if (!file.is_open())
+	ParamLayout layout;
+	for (uint32_t i = 0; valid && i < header.paramCount; i++)
 	{
-		error("Critical error: Factory_GM_Programs data not found!!\n");
+		TemplateCacheParam param;
+		valid = (end - ptr >= (std::ptrdiff_t)sizeof(param));
+		if (!valid)
+			break;
+
+		memcpy(&param, ptr, sizeof(param));
+		ptr += sizeof(param);
+
+		valid = (end - ptr >= (std::ptrdiff_t)param.keySize);
+		if (valid)
+		{
+			layout.addParam(param.id, std::string((const char*)ptr, param.keySize), param.defaultValue);
+			ptr += param.keySize;
+		}
+	}
+
+	UnmapKorgFile(mapped);
+
+	if (!valid || ptr != end)
 		return false;
+
+	out_layout = std::move(layout);
+	return true;
+}
+
+void PCG_Converter::writeTemplateCache(const std::string& templatePath, const std::string& cachePath, const ParamLayout& layout)
+{
+	TemplateCacheHeader header;
+	memcpy(header.magic, kTemplateCacheMagic, sizeof(header.magic));
+	header.paramCount = static_cast<uint32_t>(layout.ids.size());
+	if (!getTemplateStamp(templatePath, header.templateSize, header.templateTime))
+		return;
+
+	// Written aside then renamed, so that a reader never sees a partial cache. Failures only cost the cache
+	auto tempPath = cachePath + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+			return;
+
+		out.write((const char*)&header, sizeof(header));
+		for (size_t slot = 0; slot < layout.ids.size(); slot++)
+		{
+			TemplateCacheParam param = { layout.ids[slot], layout.defaultValues[slot], static_cast<uint32_t>(layout.keys[slot].size()) };
+			out.write((const char*)&param, sizeof(param));
+			out.write(layout.keys[slot].data(), layout.keys[slot].size());
+		}
+
+		if (!out.good())
+		{
+			out.close();
+
+			std::error_code ec;
+			fs::remove(tempPath, ec);
+			return;
+		}
 	}
 
-	std::streamsize fileSize = file.tellg();
-	file.seekg(0, std::ios::beg);
+	std::error_code ec;
+	fs::rename(tempPath, cachePath, ec);
+	if (ec)
+		fs::remove(tempPath, ec);
+}
 
-	m_gmData.resize(fileSize);
-	file.read(m_gmData.data(), fileSize);
+void PCG_Converter::ParamLayout::addParam(int id, const std::string& key, int defaultValue)
+{
+	keyToSlot[key] = static_cast<int>(ids.size());
+	ids.push_back(id);
+	keys.push_back(key);
+	defaultValues.push_back(defaultValue);
+
+	if (jsonPrefixOffsets.empty())
+		jsonPrefixOffsets.push_back(0);
+	jsonPrefixes += "{\"index\": " + std::to_string(id) + ", \"key\": \"" + key + "\", \"value\": ";
+	jsonPrefixOffsets.push_back(jsonPrefixes.size());
+}
+
+int PCG_Converter::ParamLayout::findSlot(const std::string& key) const
+{
+	auto found = keyToSlot.find(key);
+	return (found != keyToSlot.end()) ? found->second : -1;
+}
+
+int PCG_Converter::ParamLayout::findSlotById(int id) const
+{
+	auto found = std::lower_bound(ids.begin(), ids.end(), id);
+	return (found != ids.end() && *found == id) ? static_cast<int>(found - ids.begin()) : -1;
+}
+
+void PCG_Converter::ParamList::init(const ParamLayout& inLayout)
+{
+	layout = &inLayout;
+	values = inLayout.defaultValues;
+	writtenSlots.clear();
+	written.assign(values.size(), false);
+}
+
+int& PCG_Converter::ParamList::write(int slot)
+{
+	assert(slot >= 0 && slot < values.size());
+
+	if (!written[slot])
+	{
+		written[slot] = true;
+		writtenSlots.push_back(slot);
+	}
+
+	return values[slot];
+}
+
+void PCG_Converter::ParamList::reset()
+{
+	for (auto slot : writtenSlots)
+	{
+		values[slot] = layout->defaultValues[slot];
+		written[slot] = false;
+	}
 
-	static std::vector<std::string> kDrumKitNames = {
-		"STANDARD", "ROOM", "POWER", "ELECTRONIC", "ANALOG", "JAZZ", "BRUSH", "ORCHESTRA", "SFX" };
+	writtenSlots.clear();
+}
+
+// Factory_GM_Programs.bin v2: a header, an index of (bank, program) entries, then the records. Several entries can share a record.
+// Legacy files are the records one after the other: drum kits are only recognized by their names
+namespace
+{
+	constexpr const char kGMProgramsMagic[4] = { 'G', 'M', 'P', '2' };
+	constexpr uint32_t kGMProgramRecordSize = 540;
+	constexpr uint32_t kGMDrumKitRecordSize = 4112;
+
+	enum class EGMRecordKind : uint8_t { Program, DrumKit };
 
-	auto removeStrSpaces = [](auto& str)
+	struct GMProgramsHeader
 	{
-		const auto strEnd = str.find_last_not_of(" ");
-		return str.substr(0, strEnd + 1);
+		char magic[4];
+		uint32_t entryCount;
 	};
 
-	struct GMPreset
+	struct GMProgramsEntry
 	{
-		GMPreset(std::string&& inPresetName, int inDataOffset)
-			: presetName(std::move(inPresetName))
-			, dataOffset(inDataOffset)
-		{}
+		uint8_t bankId; // Short id
+		uint8_t programId;
+		EGMRecordKind kind;
+		uint8_t reserved;
+		uint32_t offset; // From the start of the file
+		uint32_t size;
+	};
+	static_assert(sizeof(GMProgramsHeader) == 8 && sizeof(GMProgramsEntry) == 12, "Factory_GM_Programs.bin layout");
 
-		std::string presetName;
-		int dataOffset = 0;
+	struct GMRecord
+	{
+		std::string name; // Trimmed
+		EGMRecordKind kind;
+		uint32_t offset;
+		uint32_t size;
 	};
-	std::vector<GMPreset> gmPresetsInfo;
 
-	constexpr const int regularChunkSize = 540;
-	constexpr const int drumkitChunkSize = 4112;
+	std::string trimGMName(const std::string& name)
+	{
+		return name.substr(0, name.find_last_not_of(" ") + 1);
+	}
+
+	bool isIndexedGMData(const char* data, size_t size)
+	{
+		return size >= sizeof(GMProgramsHeader) && memcmp(data, kGMProgramsMagic, sizeof(kGMProgramsMagic)) == 0;
+	}
 
-	int currentOffset = 0;
-	char* ptr = m_gmData.data();
-	while (currentOffset < fileSize)
+	// False when the index or one of its records is out of the data
+	bool readGMEntries(const char* data, size_t size, std::vector<GMProgramsEntry>& out_entries)
 	{
-		auto presetName = std::string(ptr, 16);
-		gmPresetsInfo.emplace_back(std::string(presetName), currentOffset);
+		GMProgramsHeader header;
+		memcpy(&header, data, sizeof(header));
+
+		if (sizeof(header) + uint64_t(header.entryCount) * sizeof(GMProgramsEntry) > size)
+			return false;
+
+		out_entries.resize(header.entryCount);
+		memcpy(out_entries.data(), data + sizeof(header), header.entryCount * sizeof(GMProgramsEntry));
 
-		if (std::find(kDrumKitNames.begin(), kDrumKitNames.end(), removeStrSpaces(presetName)) != kDrumKitNames.end())
+		for (auto& entry : out_entries)
 		{
-			ptr += drumkitChunkSize;
-			currentOffset += drumkitChunkSize;
+			if (entry.size < kGMProgramRecordSize || uint64_t(entry.offset) + entry.size > size)
+				return false;
 		}
-		else
+		return true;
+	}
+
+	std::vector<GMRecord> listGMRecords(const char* data, size_t size)
+	{
+		std::vector<GMRecord> records;
+
+		if (isIndexedGMData(data, size))
+		{
+			std::vector<GMProgramsEntry> entries;
+			if (!readGMEntries(data, size, entries))
+				return {};
+
+			std::vector<uint32_t> listedOffsets;
+			for (auto& entry : entries)
+			{
+				if (std::find(listedOffsets.begin(), listedOffsets.end(), entry.offset) != listedOffsets.end())
+					continue;
+
+				listedOffsets.push_back(entry.offset);
+				records.push_back({ trimGMName(std::string(data + entry.offset, 16)), entry.kind, entry.offset, entry.size });
+			}
+			return records;
+		}
+
+		static const std::vector<std::string> kDrumKitNames = {
+			"STANDARD", "ROOM", "POWER", "ELECTRONIC", "ANALOG", "JAZZ", "BRUSH", "ORCHESTRA", "SFX" };
+
+		size_t offset = 0;
+		while (offset + 16 <= size)
+		{
+			auto name = trimGMName(std::string(data + offset, 16));
+			const bool isDrumKit = std::find(kDrumKitNames.begin(), kDrumKitNames.end(), name) != kDrumKitNames.end();
+			const auto recordSize = isDrumKit ? kGMDrumKitRecordSize : kGMProgramRecordSize;
+
+			records.push_back({ std::move(name), isDrumKit ? EGMRecordKind::DrumKit : EGMRecordKind::Program,
+				static_cast<uint32_t>(offset), recordSize });
+			offset += recordSize;
+		}
+		return records;
+	}
+}
+
+bool PCG_Converter::retrieveGMData(ConverterResources& out_resources)
+{
+	auto& gmData = out_resources.gmData;
+	auto& gmDataSize = out_resources.gmDataSize;
+
+	if (auto* embedded = findEmbeddedResource("Factory_GM_Programs.bin"))
+	{
+		gmData = reinterpret_cast<const char*>(embedded->data);
+		gmDataSize = embedded->size;
+	}
+	else
+	{
+		auto filePath = getDataPath() / "Factory_GM_Programs.bin";
+		out_resources.gmFile = MapKorgFile(filePath.string().c_str());
+		if (!out_resources.gmFile)
+		{
+			error("Critical error: Factory_GM_Programs data not found!!\n");
+			return false;
+		}
+
+		gmData = reinterpret_cast<const char*>(out_resources.gmFile->data);
+		gmDataSize = out_resources.gmFile->size;
+	}
+
+	std::vector<int> programOffsets(kGMBankCount * kGMProgramCount, -1);
+	if (isIndexedGMData(gmData, gmDataSize))
+	{
+		if (!readGMIndex(gmData, gmDataSize, programOffsets))
 		{
-			ptr += regularChunkSize;
-			currentOffset += regularChunkSize;
+			error("Critical error: Factory_GM_Programs data is corrupted!\n");
+			return false;
 		}
 	}
+	else
+	{
+		// Legacy layout: the programs are found by name
+		std::unordered_map<std::string, int> offsetsByName;
+		for (auto& record : listGMRecords(gmData, gmDataSize))
+			offsetsByName.emplace(record.name, record.offset);
+
+		mapGMPrograms(offsetsByName, programOffsets);
+	}
+
+	out_resources.gmProgramOffsets = std::move(programOffsets);
+	return true;
+}
+
+bool PCG_Converter::readGMIndex(const char* gmData, size_t gmDataSize, std::vector<int>& out_programOffsets)
+{
+	std::vector<GMProgramsEntry> entries;
+	if (!readGMEntries(gmData, gmDataSize, entries))
+		return false;
+
+	for (auto& entry : entries)
+	{
+		auto bankIndex = entry.bankId - kGMFirstBankId;
+		if (bankIndex < 0 || bankIndex >= kGMBankCount || entry.programId >= kGMProgramCount)
+			return false;
 
-	int currentId = 0;
+		auto& offset = out_programOffsets[bankIndex * kGMProgramCount + entry.programId];
+		if (offset < 0)
+			offset = static_cast<int>(entry.offset);
+	}
+	return true;
+}
+
+void PCG_Converter::mapGMPrograms(const std::unordered_map<std::string, int>& valuesByName, std::vector<int>& out_table)
+{
 	for (auto& info : m_gmInfo)
 	{
-		auto& letter = info.bank;
-		auto* bankDef = Helpers::findBankDef([&letter](auto& e) { return e.name == letter; });
+		auto* bankDef = Helpers::findBankDefByName(info.bank);
 		assert(bankDef);
 
-		auto bankId = bankDef->shortId;
+		auto bankIndex = bankDef->shortId - kGMFirstBankId;
 		auto programId = info.id - 1;
-		auto name = removeStrSpaces(info.name);
-		auto factoryProgram = std::find_if(gmPresetsInfo.begin(), gmPresetsInfo.end(),
-			[&](auto& e) { return removeStrSpaces(e.presetName) == name; });
-		assert(factoryProgram != gmPresetsInfo.end());
+		assert(bankIndex >= 0 && bankIndex < kGMBankCount && programId >= 0 && programId < kGMProgramCount);
+
+		auto found = valuesByName.find(trimGMName(info.name));
+		assert(found != valuesByName.end());
 
-		m_mappedGMInfo.emplace_back(bankId, programId, factoryProgram->dataOffset);
+		// The first entry of a (bank, program) wins
+		auto& value = out_table[bankIndex * kGMProgramCount + programId];
+		if (value < 0 && found != valuesByName.end())
+			value = found->second;
 	}
+}
 
-	return true;
+int PCG_Converter::ConverterResources::findGMProgramOffset(int bankId, int programId) const
+{
+	auto bankIndex = bankId - kGMFirstBankId;
+	if (gmProgramOffsets.empty() || bankIndex < 0 || bankIndex >= kGMBankCount || programId < 0 || programId >= kGMProgramCount)
+		return -1;
+
+	return gmProgramOffsets[bankIndex * kGMProgramCount + programId];
 }
 
 bool PCG_Converter::retrieveFactoryPCG()
 {
-	auto filePath = getDataPath();
-
-	if (m_pcg->model == EnumKorgModel::KORG_TRITON_EXTREME)
-		filePath /= "Factory_TritonExtreme.PCG";
-	else
-		filePath /= "Factory_Triton.PCG";
+	std::string filename = (m_pcg->model == EnumKorgModel::KORG_TRITON_EXTREME) ? "Factory_TritonExtreme.PCG" : "Factory_Triton.PCG";
 
 	EnumKorgModel model;
-	KorgPCG* pcg = LoadTritonPCG(filePath.string().c_str(), model);
+	KorgPCG* pcg = nullptr;
+	if (auto* embedded = findEmbeddedResource(filename))
+		pcg = LoadTritonPCGFromMemory(embedded->data, embedded->size, model, false);
+	else
+		pcg = LoadTritonPCG((getDataPath() / filename).string().c_str(), model);
 
 	if (!pcg)
 	{
@@ -260,30 +642,299 @@ bool PCG_Converter::retrieveFactoryPCG()
 	}
 }
 
-KorgBank* PCG_Converter::findDependencyBank(KorgPCG* pcg, int depBank)
+const PCG_Converter::ConversionPlan& PCG_Converter::ConverterResources::getPlan(EPatchMode mode) const
 {
-	auto depBankLetter = Helpers::pcgProgBankIdToLetter(depBank);
-	KorgBank* foundBank = nullptr;
+	return (mode == EPatchMode::Combi) ? combiPlan : programPlan;
+}
+
+int PCG_Converter::ConverterResources::findSlot(EPatchMode mode, const std::string& key) const
+{
+	return getLayout(mode).findSlot(key);
+}
+
+void PCG_Converter::ConverterResources::planParams(EPatchMode mode, PlannedParams& out, const std::vector<TritonStruct>& conversions,
+	const std::string& prefix, int dataOffset) const
+{
+	for (auto& conversion : conversions)
+	{
+		if (conversion.jsonParam.empty())
+			continue;
+
+		PlannedParam param;
+		param.conversion = &conversion;
+		param.field = compileField(conversion, dataOffset);
+		param.slot = findSlot(mode, prefix + conversion.jsonParam);
+		out.push_back(param);
+	}
+}
 
-	if (pcg->Program)
+void PCG_Converter::ConverterResources::planEffect(EPatchMode mode, EffectPlan& out, const std::string& prefix, int dataOffset) const
+{
+	out.paramsByType.resize(kEffectTypeCount);
+
+	for (int effectType = 1; effectType < kEffectTypeCount; effectType++)
+	{
+		auto conversions = getEffectConversions(effectType);
+		if (!conversions.count)
+			continue;
+
+		auto& params = out.paramsByType[effectType].emplace();
+		for (auto& conversion : conversions)
+		{
+			PlannedParam param;
+			param.field = compileField(conversion, dataOffset);
+			param.slot = findSlot(mode, prefix + "_specific_parameter_" + std::string(conversion.jsonParam));
+			params.push_back(param);
+		}
+	}
+}
+
+void PCG_Converter::ConverterResources::planShared(EPatchMode mode, SharedPlan& out, const std::string& prefix) const
+{
+	out.effects.resize(2 + program_ifx_offsets.size());
+
+	planParams(mode, out.params, shared_conversions, prefix);
+	for (auto& param : out.params)
+	{
+		auto& jsonParam = param.conversion->jsonParam;
+		if (jsonParam.find("effect_type") != std::string::npos)
+		{
+			int index = jsonParam.find("mfx1") != std::string::npos ? 1 : 2;
+			int startOffset = jsonParam.find("mfx1") != std::string::npos ? 136 : 156;
+
+			param.role = PlannedParam::ERole::EffectType;
+			param.effectId = index - 1;
+			planEffect(mode, out.effects[param.effectId], utils::string_format("%smfx%d", prefix.c_str(), index), startOffset);
+		}
+	}
+
+	for (size_t i = 0; i < program_ifx_offsets.size(); i++)
 	{
-		for (uint32_t i = 0; i < pcg->Program->count; i++)
+		auto& ifx_struct = program_ifx_offsets[i];
+		auto ifxPrefix = utils::string_format("%sifx%d", prefix.c_str(), ifx_struct.id);
+
+		auto firstParam = out.params.size();
+		planParams(mode, out.params, program_ifx_conversions, ifxPrefix + "_", ifx_struct.startOffset);
+
+		for (auto j = firstParam; j < out.params.size(); j++)
 		{
-			auto* prog = pcg->Program->bank[i];
-			auto bankLetter = Helpers::bankIdToLetter(prog->bank);
-			if (bankLetter == depBankLetter)
+			auto& param = out.params[j];
+			if (param.conversion->jsonParam.find("effect_type") != std::string::npos)
 			{
-				foundBank = prog;
-				break;
+				param.role = PlannedParam::ERole::EffectType;
+				param.effectId = static_cast<int>(2 + i);
+				planEffect(mode, out.effects[param.effectId], ifxPrefix, ifx_struct.startOffset);
 			}
 		}
 	}
+}
+
+void PCG_Converter::ConverterResources::planInnerProgram(EPatchMode mode, InnerProgramPlan& out, const std::string& prefix) const
+{
+	planParams(mode, out.params, program_conversions, prefix);
+
+	static const int NUM_OSC = 2;
+	for (int iOscId = 0; iOscId < NUM_OSC; iOscId++)
+	{
+		auto oscPrefix = utils::string_format("%sosc_%d_", prefix.c_str(), iOscId + 1);
+		planParams(mode, out.osc, program_osc_conversions, oscPrefix, (iOscId == 1) ? 154 : 0);
+	}
 
-	return foundBank;
+	for (auto& param : out.osc)
+	{
+		auto& jsonParam = param.conversion->jsonParam;
+		if (jsonParam.find("hi_bank") != std::string::npos || jsonParam.find("low_bank") != std::string::npos)
+			param.role = PlannedParam::ERole::OSCBank;
+	}
+
+	planDrumKit(mode, out.drumKit, prefix);
+}
+
+void PCG_Converter::ConverterResources::planDrumKit(EPatchMode mode, DrumKitPlan& out, const std::string& prefix) const
+{
+	out.oscillatorModeSlot = findSlot(mode, prefix + "common_oscillator_mode");
+	out.drumKitNoSlot = findSlot(mode, prefix + "osc_1_hi_sample_no.");
+
+	for (size_t noteId = 0; noteId < drumkit_notes.size(); noteId++)
+	{
+		auto notePrefix = prefix + "user_drumkit_parameter_" + drumkit_notes[noteId] + "_";
+		planParams(mode, out.params, drumkit_conversions, notePrefix, static_cast<int>(32 * noteId));
+	}
+
+	for (auto& param : out.params)
+	{
+		auto& jsonParam = param.conversion->jsonParam;
+		if (jsonParam.find("higher_bank") != std::string::npos || jsonParam.find("lower_bank") != std::string::npos)
+			param.role = PlannedParam::ERole::OSCBank;
+	}
+}
+
+void PCG_Converter::ConverterResources::planArpeggiator(EPatchMode mode, ArpeggiatorPlan& out, const std::string& prefix, const std::string& patternNoKey) const
+{
+	out.patternNoSlot = findSlot(mode, patternNoKey);
+
+	const auto patternPrefix = prefix + "pattern_parameter_";
+	planParams(mode, out.params, arpeggiator_global_conversions, patternPrefix);
+
+	const int maxSteps = 48;
+	for (int iStep = 0; iStep < maxSteps; iStep++)
+	{
+		auto stepPrefix = utils::string_format("%sstep_%d_", patternPrefix.c_str(), iStep);
+		planParams(mode, out.params, arpeggiator_step_conversions, stepPrefix, 6 * iStep);
+	}
+
+	auto addFactoryValue = [&](const std::string& key, int value)
+	{
+		out.factoryPatternValues.emplace_back(findSlot(mode, patternPrefix + key), value);
+	};
+
+	addFactoryValue("length", 1);
+	addFactoryValue("tone_mode", 0);
+	addFactoryValue("fixed_note_mode", 0);
+
+	const int maxTones = 12;
+	for (int i = 1; i <= maxTones; i++)
+		addFactoryValue(utils::string_format("tone_note_no.%d", i), 0);
+
+	for (int i = 0; i < maxSteps; i++)
+	{
+		addFactoryValue(utils::string_format("step_%d_gate", i), 0);
+		addFactoryValue(utils::string_format("step_%d_velocity", i), 1);
+
+		for (int j = 0; j < maxTones; j++)
+			addFactoryValue(utils::string_format("step_%d_tone_%d", i, j), 0);
+	}
+}
+
+void PCG_Converter::ConverterResources::planUnusedValues(EPatchMode mode, UnusedValuesPlan& out, const std::string& prefix) const
+{
+	auto slotValue = [&](const std::string& name, int value)
+	{
+		auto slot = findSlot(mode, prefix + name);
+		assert(slot >= 0);
+		return UnusedValuesPlan::SlotValue{ slot, value };
+	};
+
+	const bool isTimbre = prefix.find("combi_timbre") != std::string::npos;
+
+	if (mode == EPatchMode::Program || isTimbre)
+	{
+		out.fixups =
+		{
+			{ slotValue("common_oscillator_mode", 2), slotValue("osc_1_output_use_drum_kit_setting", 1) },
+			{ slotValue("osc_1_low_sample_no.", 4095), slotValue("osc_1_low_sample_no.", 999) }, // N/A patch
+			{ slotValue("osc_2_low_sample_no.", 4095), slotValue("osc_2_low_sample_no.", 999) }, // N/A patch
+		};
+	}
+
+	// Patching knobs default value (only for program or global combi, not timber)
+	if (!isTimbre)
+	{
+		const bool isCombi = prefix.find("combi_") != std::string::npos;
+		for (int i = 1; i <= 4; i++)
+		{
+			auto assignName = utils::string_format(isCombi ? "knob%d_assign_type" : "common_knob%d_assign_type", i);
+			out.knobs.emplace_back(slotValue(assignName, 0).slot, slotValue(utils::string_format("knob%d", i), 0).slot);
+		}
+	}
+
+	if (isTimbre)
+	{
+		out.ignored =
+		{
+			slotValue("arpeggiator_gate_control", 0),
+			slotValue("arpeggiator_velocity_control", 0),
+			slotValue("arpeggiator_tempo", 40),
+			slotValue("arpeggiator_switch", 0),
+			slotValue("arpeggiator_pattern_no.", 0),
+			slotValue("arpeggiator_resolution", 0),
+			slotValue("arpeggiator_octave", 0),
+			slotValue("arpeggiator_gate", 0),
+			slotValue("arpeggiator_velocity", 1),
+			slotValue("arpeggiator_swing", 0),
+			slotValue("arpeggiator_sort_onoff", 0),
+			slotValue("arpeggiator_latch_onoff", 0),
+			slotValue("arpeggiator_keysync_onoff", 0),
+			slotValue("arpeggiator_keyboard_onoff", 0),
+			slotValue("arpeggiator_top_key", 0),
+			slotValue("arpeggiator_bottom_key", 0),
+			slotValue("arpeggiator_top_velocity", 1),
+			slotValue("arpeggiator_bottom_velocity", 1),
+			slotValue("osc_1_low_start_offset", 0),
+			slotValue("osc_2_low_start_offset", 0)
+		};
+	}
+}
+
+void PCG_Converter::ConverterResources::initConversionPlans()
+{
+	{
+		const auto mode = EPatchMode::Program;
+		auto& plan = programPlan;
+
+		planShared(mode, plan.shared, "prog_");
+		planParams(mode, plan.extreme, triton_extreme_conversions, "prog_");
+		planInnerProgram(mode, plan.program, "prog_");
+		planArpeggiator(mode, plan.arpeggiators.emplace_back(), "prog_user_arp_", "prog_arpeggiator_pattern_no.");
+		planUnusedValues(mode, plan.unusedValues, "prog_");
+	}
+
+	{
+		const auto mode = EPatchMode::Combi;
+		auto& plan = combiPlan;
+
+		planParams(mode, plan.combi, combi_conversions, "");
+		planShared(mode, plan.shared, "combi_");
+		planParams(mode, plan.extreme, triton_extreme_conversions, "combi_");
+		planUnusedValues(mode, plan.unusedValues, "combi_");
+
+		for (auto& timbre : combi_timbres)
+		{
+			auto prefix = utils::string_format("combi_timbre_%d_", timbre.id);
+
+			auto& timbreParams = plan.timbres.emplace_back();
+			planParams(mode, timbreParams, combi_timbre_conversions, prefix, timbre.startOffset);
+
+			for (auto& param : timbreParams)
+			{
+				if (param.conversion->jsonParam.find("program_no") != std::string::npos)
+					param.role = PlannedParam::ERole::TimbreProgram;
+				else if (param.conversion->jsonParam.find("program_bank") != std::string::npos)
+					param.role = PlannedParam::ERole::TimbreBank;
+			}
+
+			planInnerProgram(mode, plan.timbrePrograms.emplace_back(), prefix);
+			planUnusedValues(mode, plan.timbreUnusedValues.emplace_back(), prefix);
+			plan.timbreBankSlots.push_back(findSlot(mode, prefix + "program_bank"));
+		}
+
+		for (auto arpLetter : { "a", "b" })
+		{
+			planArpeggiator(mode, plan.arpeggiators.emplace_back(), utils::string_format("combi_user_arp_%s_", arpLetter),
+				utils::string_format("combi_arpeggiator_%s_pattern_no.", arpLetter));
+		}
+	}
+}
+
+KorgBank* PCG_Converter::findDependencyBank(KorgPCG* pcg, int depBank)
+{
+	ScopedPhase phase(*this, EPhase::DependencyLookup);
+
+	// The PCG program banks are indexed by short id
+	if (depBank < 0 || depBank >= kKorgBankSlots)
+		return nullptr;
+
+	return pcg->ProgramSlots[depBank];
 }
 
 void PCG_Converter::log(const std::string& text)
 {
+	if (m_logBuffer)
+	{
+		m_logBuffer->push_back({ text });
+		return;
+	}
+
 	if (m_logFunc)
 		m_logFunc(text);
 	else
@@ -298,75 +949,135 @@ void PCG_Converter::error(const std::string& text)
 		std::cerr << text;
 }
 
-void PCG_Converter::convertPrograms(const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds)
+void PCG_Converter::logOnce(EWarning warning, const std::string& text)
 {
-	if (!m_initialized)
+	if (m_logBuffer)
+	{
+		m_logBuffer->push_back({ text, warning });
 		return;
+	}
 
-	assert(letters.size() == targetLetterIds.size());
+	// Converters of a batch may share the flags from several threads
+	if ((*m_printedWarnings)[static_cast<size_t>(warning)].exchange(true))
+		return;
 
-	for (int iLetter = 0; iLetter < letters.size(); iLetter++)
+	log(text);
+}
+
+PCG_Converter::ScopedPhase::ScopedPhase(PCG_Converter& converter, EPhase phase, std::ostream* output)
+	: m_phase(phase)
+{
+	if (!m_instrumented)
+		return;
+
+	m_converter = &converter;
+	m_paramWrites = converter.m_paramWrites;
+	if (output)
 	{
-		KorgBank* foundBank = nullptr;
+		m_output = output;
+		m_outputStart = output->tellp();
+	}
+	m_start = std::chrono::steady_clock::now();
+}
 
-		for (uint32_t i = 0; i < m_pcg->Program->count; i++)
-		{
-			auto* bank = m_pcg->Program->bank[i];
-			auto bankLetter = Helpers::bankIdToLetter(bank->bank);
+PCG_Converter::ScopedPhase::~ScopedPhase()
+{
+	if (!m_converter)
+		return;
 
-			if (bankLetter == letters[iLetter])
-			{
-				foundBank = bank;
-				break;
-			}
-		}
+	auto& stats = m_converter->m_phaseReport[static_cast<size_t>(m_phase)];
+	stats.calls++;
+	stats.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+	stats.paramsWritten += m_converter->m_paramWrites - m_paramWrites;
 
-		assert(foundBank);
-		if (!foundBank)
-			continue;
+	if (m_output && m_outputStart >= 0)
+	{
+		std::streamoff outputEnd = m_output->tellp();
+		if (outputEnd >= m_outputStart)
+			stats.bytesWritten += outputEnd - m_outputStart;
+	}
+}
 
-		int targetLetterId = targetLetterIds[iLetter];
-		assert(targetLetterId >= 0 && targetLetterId < vst_bank_letters.size());
-		auto targetLetter = vst_bank_letters[targetLetterId];
-		auto userFolder = Helpers::createSubfolders(m_destFolder, "Program", targetLetter);
+static const char* kPhaseNames[] = {
+	"templates", "factory_data", "inner_program", "shared_conversions", "effect", "arpeggiator", "drumkit",
+	"dependency_lookup", "json_write", "file_io" };
+static_assert(std::size(kPhaseNames) == static_cast<size_t>(PCG_Converter::EPhase::Count));
 
-		for (uint32_t j = 0; j < foundBank->count; j++)
-		{
-			auto* item = foundBank->item[j];
-			auto name = std::string((char*)item->data, 16);
+void PCG_Converter::addPhaseReport(PhaseReport& to, const PhaseReport& from)
+{
+	for (size_t i = 0; i < to.size(); i++)
+	{
+		to[i].calls += from[i].calls;
+		to[i].nanoseconds += from[i].nanoseconds;
+		to[i].paramsWritten += from[i].paramsWritten;
+		to[i].bytesWritten += from[i].bytesWritten;
+	}
+}
+
+void PCG_Converter::writePhaseReport(std::ostream& out, const PhaseReport& report)
+{
+	out << std::left << std::setw(20) << "Phase" << std::right << std::setw(10) << "Calls" << std::setw(12) << "Time (ms)"
+		<< std::setw(16) << "Params written" << std::setw(16) << "Bytes written" << "\n";
 
-			std::stringstream msgStrm;
-			msgStrm << "Program " << Helpers::bankIdToLetter(foundBank->bank) << ":" << std::setw(3) << std::setfill('0') << j;
-			msgStrm << " " << name << "\n";
-			log(msgStrm.str());
+	for (size_t i = 0; i < report.size(); i++)
+	{
+		auto& stats = report[i];
+		out << std::left << std::setw(20) << kPhaseNames[i] << std::right << std::setw(10) << stats.calls
+			<< std::setw(12) << std::fixed << std::setprecision(1) << stats.nanoseconds / 1e6
+			<< std::setw(16) << stats.paramsWritten << std::setw(16) << stats.bytesWritten << "\n";
+	}
+}
 
-			patchProgramToJson(foundBank->bank, j, name, item->data, userFolder, targetLetter);
-		}
+void PCG_Converter::writePhaseReportJson(std::ostream& out, const PhaseReport& report)
+{
+	out << "{\"phases\": [";
+	for (size_t i = 0; i < report.size(); i++)
+	{
+		auto& stats = report[i];
+		if (i > 0) out << ", ";
+		out << "{\"name\": \"" << kPhaseNames[i] << "\", \"calls\": " << stats.calls << ", \"nanoseconds\": " << stats.nanoseconds
+			<< ", \"params_written\": " << stats.paramsWritten << ", \"bytes_written\": " << stats.bytesWritten << "}";
 	}
+	out << "]}" << std::endl;
+}
+
+void PCG_Converter::flushLog(const std::vector<LogEntry>& entries)
+{
+	for (auto& entry : entries)
+	{
+		if (entry.warning.has_value())
+			logOnce(*entry.warning, entry.text);
+		else
+			log(entry.text);
+	}
+}
+
+void PCG_Converter::convertPrograms(const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds)
+{
+	convertBanks(EPatchMode::Program, letters, targetLetterIds);
 }
 
 void PCG_Converter::convertCombis(const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds)
+{
+	convertBanks(EPatchMode::Combi, letters, targetLetterIds);
+}
+
+void PCG_Converter::convertBanks(EPatchMode mode, const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds)
 {
 	if (!m_initialized)
 		return;
 
 	assert(letters.size() == targetLetterIds.size());
 
-	for (int iLetter = 0; iLetter < letters.size(); iLetter++)
-	{
-		KorgBank* foundBank = nullptr;
+	const bool isProgram = (mode == EPatchMode::Program);
+	KorgBank* const* slots = isProgram ? m_pcg->ProgramSlots : m_pcg->CombinationSlots;
 
-		for (uint32_t i = 0; i < m_pcg->Combination->count; i++)
-		{
-			auto* bank = m_pcg->Combination->bank[i];
-			auto bankLetter = Helpers::bankIdToLetter(bank->bank);
+	std::vector<ConversionJob> jobs;
 
-			if (bankLetter == letters[iLetter])
-			{
-				foundBank = bank;
-				break;
-			}
-		}
+	for (int iLetter = 0; iLetter < letters.size(); iLetter++)
+	{
+		auto* bankDef = Helpers::findBankDefByName(letters[iLetter]);
+		KorgBank* foundBank = bankDef ? slots[bankDef->shortId] : nullptr;
 
 		assert(foundBank);
 		if (!foundBank)
@@ -375,129 +1086,181 @@ void PCG_Converter::convertCombis(const std::vector<std::string>& letters, const
 		int targetLetterId = targetLetterIds[iLetter];
 		assert(targetLetterId >= 0 && targetLetterId < vst_bank_letters.size());
 		auto targetLetter = vst_bank_letters[targetLetterId];
-		auto userFolder = Helpers::createSubfolders(m_destFolder, "Combi", targetLetter);
+		auto userFolder = Helpers::createSubfolders(m_destFolder, isProgram ? "Program" : "Combi", targetLetter);
+
+		for (uint32_t j = 0; j < foundBank->count; j++)
+			jobs.push_back({ foundBank, j, userFolder, targetLetter });
+	}
+
+	if (m_workerCount > 1 && jobs.size() > 1)
+	{
+		convertJobsParallel(mode, jobs);
+	}
+	else
+	{
+		for (auto& job : jobs)
+			convertJob(mode, job);
+	}
+}
+
+void PCG_Converter::convertJob(EPatchMode mode, const ConversionJob& job)
+{
+	auto* item = GetKorgItem(job.bank, job.presetId);
+	auto name = std::string((char*)item->data, 16);
 
-		for (uint32_t jPreset = 0; jPreset < foundBank->count; jPreset++)
+	std::stringstream msgStrm;
+	msgStrm << (mode == EPatchMode::Program ? "Program " : "Combi ");
+	msgStrm << Helpers::bankIdToLetter(job.bank->bank) << ":" << std::setw(3) << std::setfill('0') << job.presetId;
+	msgStrm << " " << name << "\n";
+	log(msgStrm.str());
+
+	if (mode == EPatchMode::Program)
+		patchProgramToJson(job.bank->bank, job.presetId, name, item->data, job.userFolder, job.targetLetter);
+	else
+		patchCombiToJson(job.bank->bank, job.presetId, name, item->data, job.userFolder, job.targetLetter);
+}
+
+const PCG_Converter::ParamLayout& PCG_Converter::ConverterResources::getLayout(EPatchMode mode) const
+{
+	return (mode == EPatchMode::Combi) ? combiLayout : programLayout;
+}
+
+const PCG_Converter::ParamLayout& PCG_Converter::getLayout(EPatchMode mode) const
+{
+	return m_resources->getLayout(mode);
+}
+
+PCG_Converter::ParamList& PCG_Converter::getParams(EPatchMode mode)
+{
+	return (mode == EPatchMode::Combi) ? m_dictCombiParams : m_dictProgParams;
+}
+
+int& PCG_Converter::getValueBySlot(EPatchMode mode, int slot)
+{
+	m_paramWrites++;
+	return getParams(mode).write(slot);
+}
+
+void PCG_Converter::convertJobsParallel(EPatchMode mode, const std::vector<ConversionJob>& jobs)
+{
+	// Presets are split into contiguous chunks, one per worker. Every preset starts from the template defaults,
+	// so a chunk doesn't depend on the ones before it
+	const size_t numChunks = std::min<size_t>(m_workerCount, jobs.size());
+	auto chunkBegin = [&](size_t chunk) { return chunk * jobs.size() / numChunks; };
+
+	std::vector<std::unique_ptr<PCG_Converter>> workers;
+	for (size_t chunk = 0; chunk < numChunks; chunk++)
+		workers.push_back(std::make_unique<PCG_Converter>(*this, m_destFolder));
+
+	std::vector<std::vector<LogEntry>> jobLogs(jobs.size());
+	std::vector<bool> jobDone(jobs.size(), false);
+	std::mutex jobMutex;
+	std::condition_variable jobCondition;
+
+	std::vector<std::thread> threads;
+	for (size_t chunk = 0; chunk < numChunks; chunk++)
+	{
+		threads.emplace_back([&, chunk]()
 		{
-			auto* item = foundBank->item[jPreset];
-			auto name = std::string((char*)item->data, 16);
+			auto& worker = *workers[chunk];
 
-			std::stringstream msgStrm;
-			msgStrm << "Combi " << Helpers::bankIdToLetter(foundBank->bank) << ":" << std::setw(3) << std::setfill('0') << jPreset;
-			msgStrm << " " << name << "\n";
-			log(msgStrm.str());
+			for (size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++)
+			{
+				worker.m_logBuffer = &jobLogs[i];
+				worker.convertJob(mode, jobs[i]);
 
-			patchCombiToJson(foundBank->bank, jPreset, name, item->data, userFolder, targetLetter);
+				std::lock_guard<std::mutex> lock(jobMutex);
+				jobDone[i] = true;
+				jobCondition.notify_all();
+			}
+		});
+	}
+
+	// Logs are flushed from the calling thread, in the same order as the sequential path
+	for (size_t i = 0; i < jobs.size(); i++)
+	{
+		{
+			std::unique_lock<std::mutex> lock(jobMutex);
+			jobCondition.wait(lock, [&]() { return jobDone[i]; });
 		}
+
+		flushLog(jobLogs[i]);
 	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	for (auto& worker : workers)
+		addPhaseReport(m_phaseReport, worker->m_phaseReport);
+
+	// The converter keeps the state of the last preset, like the sequential path
+	getParams(mode) = std::move(workers.back()->getParams(mode));
 }
 
-template<typename T>
-T getBits_Impl(void* data, int offset, int bitstart, int bitend)
+int PCG_Converter::getPCGValue(const unsigned char* data, const TritonStruct& info, int baseOffset)
 {
-	assert(bitend >= bitstart);
-	T* s = (T*)data + offset;
-	unsigned bitmask = (1 << (bitend - bitstart + 1)) - 1;
-	return (T)((*s >> bitstart) & bitmask);
+	return getFieldValue(data, compileField(info, baseOffset));
 }
 
-short getBits(EVarType type, void* data, int offset, int bitstart, int bitend)
-{
-	if (type == EVarType::Signed)
-		return getBits_Impl<char>(data, offset, bitstart, bitend);
-	else
-		return getBits_Impl<unsigned char>(data, offset, bitstart, bitend);
-}
-
-struct twoBits { char d : 2; };
-struct threeBits { char d : 3; };
-struct fourBits { char d : 4; };
-struct fiveBits { char d : 5; };
-struct sixBits { char d : 6; };
-struct sevenBits { char d : 7; };
-struct eightBits { char d : 8; };
-struct nineBits { short d : 9; };
-struct tenBits { short d : 10; };
-struct elevenBits { short d : 11; };
-struct twelveBits { short d : 12; };
-struct thirteenBits { short d : 13; };
-struct sixteenBits { short d : 16; };
-
-template<typename S, typename T>
-T convertOddValue(T val)
-{
-	S temp;
-	temp.d = val;
-	return static_cast<T>(temp.d);
-}
-
-int convertValue(int val, int numBits)
-{
-	if (numBits == 2)
-		return convertOddValue<twoBits>(val);
-	else if (numBits == 3)
-		return convertOddValue<threeBits>(val);
-	else if (numBits == 4)
-		return convertOddValue<fourBits>(val);
-	else if (numBits == 5)
-		return convertOddValue<fiveBits>(val);
-	else if (numBits == 6)
-		return convertOddValue<sixBits>(val);
-	else if (numBits == 7)
-		return convertOddValue<sevenBits>(val);
-	else if (numBits == 8)
-		return convertOddValue<eightBits>(val);
-	else if (numBits == 9)
-		return convertOddValue<nineBits>(val);
-	else if (numBits == 10)
-		return convertOddValue<tenBits>(val);
-	else if (numBits == 11)
-		return convertOddValue<elevenBits>(val);
-	else if (numBits == 12)
-		return convertOddValue<twelveBits>(val);
-	else if (numBits == 13)
-		return convertOddValue<thirteenBits>(val);
-	else if (numBits == 16)
-		return convertOddValue<sixteenBits>(val);
-
-	return val;
-}
-
-int PCG_Converter::getPCGValue(unsigned char* data, TritonStruct& info)
+template<typename Conversion>
+PCGField compileConversion(const Conversion& info, int dataOffset)
 {
+	PCGField field;
+	auto addPart = [&](EVarType type, int offset, int bitStart, int bitEnd)
+	{
+		assert(bitEnd >= bitStart);
+		auto width = bitEnd - bitStart + 1;
+
+		auto& part = field.parts[field.partCount++];
+		part.offset = dataOffset + offset;
+		part.shift = static_cast<uint8_t>(bitStart);
+		part.mask = static_cast<uint8_t>((1u << width) - 1); // Parts are read from a single byte
+		part.width = static_cast<uint8_t>(width);
+		part.isSigned = (type == EVarType::Signed);
+		return width;
+	};
+
+	// Values made of several parts are assembled unsigned, then sign extended as a whole
 	auto varType = (info.pcgLSBOffset >= 0 || info.third.has_value()) ? EVarType::Unsigned : info.varType;
-	int result = getBits(varType, data, info.pcgOffset, info.pcgBitStart, info.pcgBitEnd);
+	auto numBits = addPart(varType, info.pcgOffset, info.pcgBitStart, info.pcgBitEnd);
 
-	auto numBits = info.pcgBitEnd - info.pcgBitStart + 1;
 	if (info.pcgLSBOffset >= 0)
-	{
-		short bitShift = (info.pcgLSBBitEnd - info.pcgLSBBitStart + 1);
-		result <<= bitShift;
+		numBits += addPart(varType, info.pcgLSBOffset, info.pcgLSBBitStart, info.pcgLSBBitEnd);
 
-		int lsbVal = static_cast<int>(getBits(varType, data, info.pcgLSBOffset, info.pcgLSBBitStart, info.pcgLSBBitEnd));
-		result |= lsbVal;
+	if (info.third.has_value())
+		numBits += addPart(info.varType, info.third->offset, info.third->bit_start, info.third->bit_end);
 
-		numBits += bitShift;
-	}
+	if (info.varType == EVarType::Signed)
+		field.signShift = static_cast<uint8_t>(signExtensionShift(numBits));
 
-	if (info.third.has_value())
-	{
-		short bitShift = (info.third->bit_end - info.third->bit_start + 1);
-		result <<= bitShift;
+	return field;
+}
 
-		int lsbVal = static_cast<int>(getBits(info.varType, data, info.third->offset, info.third->bit_start, info.third->bit_end));
-		result |= lsbVal;
+PCGField PCG_Converter::compileField(const TritonStruct& info, int dataOffset)
+{
+	return compileConversion(info, dataOffset);
+}
 
-		numBits += bitShift;
-	}
+PCGField PCG_Converter::compileField(const EffectConversion& info, int dataOffset)
+{
+	return compileConversion(info, dataOffset);
+}
 
-	// Convert values with odd num bits
-	if (info.varType == EVarType::Signed)
+int PCG_Converter::getFieldValue(const unsigned char* data, const PCGField& field)
+{
+	int result = 0;
+	for (uint8_t i = 0; i < field.partCount; i++)
 	{
-		result = convertValue(result, numBits);
+		auto& part = field.parts[i];
+		int byte = part.isSigned ? static_cast<signed char>(data[part.offset]) : data[part.offset];
+		int bits = (byte >> part.shift) & part.mask;
+		if (part.isSigned)
+			bits = static_cast<signed char>(bits);
+
+		result = static_cast<int>(static_cast<unsigned>(result) << part.width) | bits;
 	}
 
-	return result;
+	return signExtendWithShift(result, field.signShift);
 }
 
 std::string getPresetNameSafe(const std::string& presetName)
@@ -532,9 +1295,9 @@ std::pair<int, std::string> PCG_Converter::getCategory(EPatchMode mode, EnumKorg
 	const bool isCombi = (mode == EPatchMode::Combi);
 	const bool isTritonCombi = isCombi && model != EnumKorgModel::KORG_TRITON_EXTREME;
 	auto index = isCombi ? 5702 : 6474; // combi_category / prog_common_category
-	auto found = content.find(index);
-	assert(found != content.end());
-	auto categoryId = found->second.value;
+	auto slot = content.layout->findSlotById(index);
+	assert(slot >= 0);
+	auto categoryId = content.values[slot];
 
 	std::string name;
 
@@ -619,14 +1382,32 @@ void PCG_Converter::jsonWriteDSPSettings(std::ostream& json, const PCG_Converter
 {
 	json << "\"dsp_settings\": [";
 
-	bool bAddComma = false;
-	for (auto& param : content)
+	auto& layout = *content.layout;
+	const char* prefixes = layout.jsonPrefixes.data();
+
+	// Only the values change between presets: the rest of each entry is copied from the layout
+	constexpr const size_t kMaxValueSize = 16; // ", " + int + "}"
+	m_jsonBuffer.resize(layout.jsonPrefixes.size() + content.values.size() * kMaxValueSize);
+	char* out = m_jsonBuffer.data();
+
+	for (size_t slot = 0; slot < content.values.size(); slot++)
 	{
-		if (bAddComma) json << ", ";
-		json << "{\"index\": " << param.first << ", \"key\": \"" << param.second.key << "\", \"value\": " << param.second.value << "}";
+		if (slot > 0)
+		{
+			*out++ = ',';
+			*out++ = ' ';
+		}
 
-		if (!bAddComma) bAddComma = true;
+		auto prefixStart = layout.jsonPrefixOffsets[slot];
+		auto prefixSize = layout.jsonPrefixOffsets[slot + 1] - prefixStart;
+		memcpy(out, prefixes + prefixStart, prefixSize);
+		out += prefixSize;
+
+		out = std::to_chars(out, out + kMaxValueSize, content.values[slot]).ptr;
+		*out++ = '}';
 	}
+
+	json.write(m_jsonBuffer.data(), out - m_jsonBuffer.data());
 }
 
 void PCG_Converter::patchProgramToStream(int bankId, int presetId, const std::string& presetName, unsigned char* data,
@@ -636,50 +1417,53 @@ void PCG_Converter::patchProgramToStream(int bankId, int presetId, const std::st
 	auto& content = m_dictProgParams;
 	auto bankNumber = Helpers::getVSTBankNumber(mode, targetLetter, m_targetModel);
 
-	patchInnerProgram(content, "prog_", data, presetName, mode);
-	patchArpeggiator(content, "prog_user_arp_", "prog_arpeggiator_pattern_no.", data, mode);
-	patchDrumKit(content, "prog_", data, mode);
-	patchProgramUnusedValues(mode, content, "prog_");
+	patchProgram(data);
 
+	ScopedPhase phase(*this, EPhase::JsonWrite, &out_stream);
 	jsonWriteHeaderBegin(out_stream, presetName, mode, m_targetModel, content);
 	jsonWriteHeaderEnd(out_stream, presetId, bankNumber, targetLetter, "Program");
 	jsonWriteDSPSettings(out_stream, content);
 	jsonWriteEnd(out_stream, "program");
 }
 
+void PCG_Converter::patchProgram(unsigned char* data)
+{
+	const auto mode = EPatchMode::Program;
+	auto& content = m_dictProgParams;
+
+	content.reset();
+	patchInnerProgram(mode, getPlan(mode).program, data);
+	patchArpeggiator(mode, getPlan(mode).arpeggiators[0]);
+	patchDrumKit(mode, getPlan(mode).program.drumKit);
+	patchUnusedValues(mode, getPlan(mode).unusedValues);
+}
+
 void PCG_Converter::patchProgramToJson(int bankId, int presetId, const std::string& presetName, unsigned char* data,
 	const std::string& userFolder, const std::string& targetLetter)
 {
 	auto outFilePath = getOutputPatchPath(presetId, userFolder);
-	std::ofstream json(outFilePath);
+	std::ofstream json;
+	{
+		ScopedPhase phase(*this, EPhase::FileIO);
+		json.open(outFilePath);
+	}
+
 	patchProgramToStream(bankId, presetId, presetName, data, targetLetter, json);
+
+	ScopedPhase phase(*this, EPhase::FileIO);
+	json.close();
 }
 
-void PCG_Converter::patchEffect(EPatchMode mode, PCG_Converter::ParamList& content, int dataOffset, unsigned char* data, int effectId, const std::string& prefix)
+void PCG_Converter::patchEffect(EPatchMode mode, const EffectPlan& plan, unsigned char* data, int effectId)
 {
 	if (effectId == 0) // No effect
 		return;
 
-	auto foundEntry = effect_conversions.find(effectId);
-	if (foundEntry != effect_conversions.end())
-	{
-		for (const auto& spec_conv : foundEntry->second)
-		{
-			if (spec_conv.jsonParam.empty())
-				continue;
-
-			auto info = TritonStruct(spec_conv);
-			info.pcgOffset += dataOffset;
-			if (info.pcgLSBOffset != -1)
-				info.pcgLSBOffset += dataOffset;
-			if (info.third.has_value())
-				info.third->offset += dataOffset;
-
-			auto jsonName = utils::string_format("%s_specific_parameter_%s", prefix.c_str(), spec_conv.jsonParam.c_str());
-			auto pcgVal = getPCGValue(data, info);
+	ScopedPhase phase(*this, EPhase::Effect);
 
-			patchValue(mode, content, jsonName, pcgVal);
-		}
+	if (effectId > 0 && effectId < plan.paramsByType.size() && plan.paramsByType[effectId].has_value())
+	{
+		patchPlannedParams(mode, *plan.paramsByType[effectId], data);
 	}
 	else
 	{
@@ -688,252 +1472,150 @@ void PCG_Converter::patchEffect(EPatchMode mode, PCG_Converter::ParamList& conte
 	}
 }
 
-PCG_Converter::ProgParam* PCG_Converter::findParamByKey(EPatchMode mode, PCG_Converter::ParamList& content, const std::string& key)
+void PCG_Converter::getPlannedRawValues(const unsigned char* data, const PlannedParam* params, size_t count, int* out_values)
 {
-	auto& m = (mode == EPatchMode::Combi) ? m_mapCombi_keyToId : m_mapProgram_keyToId;
-	auto id = m.find(key);
-	assert(id != m.end());
-	auto found = content.find(id->second);
-	assert(found != content.end());
-	return &(found->second);
+	for (size_t i = 0; i < count; i++)
+		out_values[i] = getFieldValue(data, params[i].field);
 }
 
-void PCG_Converter::patchValue(EPatchMode mode, PCG_Converter::ParamList& content, const std::string& jsonName, int value)
+template<typename Func>
+void PCG_Converter::forEachPlannedValue(EPatchMode mode, const PlannedParams& params, unsigned char* data, Func&& func)
 {
-	auto* found = findParamByKey(mode, content, jsonName);
-	found->value = value;
+	static constexpr size_t kBatchSize = 64;
+	std::array<int, kBatchSize> rawValues;
+
+	for (size_t first = 0; first < params.size(); first += kBatchSize)
+	{
+		auto count = std::min(kBatchSize, params.size() - first);
+		getPlannedRawValues(data, params.data() + first, count, rawValues.data());
+
+		for (size_t i = 0; i < count; i++)
+		{
+			auto& param = params[first + i];
+			func(param, convertPlannedValue(mode, param, rawValues[i], data));
+		}
+	}
 }
 
-void PCG_Converter::patchCombiUnusedValues(PCG_Converter::ParamList& content, const std::string& prefix)
+void PCG_Converter::patchPlannedParams(EPatchMode mode, const PlannedParams& params, unsigned char* data)
 {
-	struct NameValue { std::string name; int value; };
-
-	std::vector<NameValue> ignoredParams =
+	forEachPlannedValue(mode, params, data, [&](const PlannedParam& param, int value)
 	{
-		{ "arpeggiator_gate_control", 0 },
-		{ "arpeggiator_velocity_control", 0 },
-		{ "arpeggiator_tempo", 40 },
-		{ "arpeggiator_switch", 0 },
-		{ "arpeggiator_pattern_no.", 0 },
-		{ "arpeggiator_resolution", 0 },
-		{ "arpeggiator_octave", 0 },
-		{ "arpeggiator_gate", 0 },
-		{ "arpeggiator_velocity", 1 },
-		{ "arpeggiator_swing", 0 },
-		{ "arpeggiator_sort_onoff", 0 },
-		{ "arpeggiator_latch_onoff", 0 },
-		{ "arpeggiator_keysync_onoff", 0 },
-		{ "arpeggiator_keyboard_onoff", 0 },
-		{ "arpeggiator_top_key", 0 },
-		{ "arpeggiator_bottom_key", 0 },
-		{ "arpeggiator_top_velocity", 1 },
-		{ "arpeggiator_bottom_velocity", 1 },
-		{ "osc_1_low_start_offset", 0 },
-		{ "osc_2_low_start_offset", 0 }
-	};
+		patchPlanned(mode, param, value);
+	});
+}
 
-	for (auto& ignoredParam : ignoredParams)
+int PCG_Converter::convertPlannedValue(EPatchMode mode, const PlannedParam& param, int rawValue, unsigned char* data)
+{
+	if (param.role == PlannedParam::ERole::OSCBank)
 	{
-		std::string fullParamName = prefix + ignoredParam.name;
-		auto* found = findParamByKey(EPatchMode::Combi, content, fullParamName);
-		found->value = ignoredParam.value;
+		assert(param.slot >= 0);
+		auto& paramName = (param.slot >= 0) ? getLayout(mode).keys[param.slot] : param.conversion->jsonParam;
+		return convertOSCBank(rawValue, paramName, data);
 	}
+
+	return rawValue;
 }
 
-void PCG_Converter::patchProgramUnusedValues(EPatchMode mode, PCG_Converter::ParamList& content, const std::string& prefix)
+void PCG_Converter::patchPlanned(EPatchMode mode, const PlannedParam& param, int value)
 {
-	struct NameValue { std::string name; int value; };
+	assert(param.slot >= 0 && "Param not found in template");
+	if (param.slot >= 0)
+		getValueBySlot(mode, param.slot) = value;
+}
 
-	struct ProgramPatch
-	{
-		NameValue param;
-		std::vector<NameValue> paramsToUpdate;
-	};
+void PCG_Converter::patchUnusedValues(EPatchMode mode, const UnusedValuesPlan& plan)
+{
+	// Sources and assign types are only read: they are not params written by the preset
+	const auto& values = getParams(mode).values;
 
-	auto fullParamName = [&](auto& name)
+	for (auto& [source, target] : plan.fixups)
 	{
-		return prefix + name;
-	};
+		if (values[source.slot] == source.value)
+			getValueBySlot(mode, target.slot) = target.value;
+	}
 
-	std::vector<ProgramPatch> allPatches =
+	for (auto& [assignSlot, knobSlot] : plan.knobs)
 	{
-		{ { "common_oscillator_mode", 2 }, {{ "osc_1_output_use_drum_kit_setting", 1 }} },
-		{ { "osc_1_low_sample_no.", 4095 }, {{ "osc_1_low_sample_no.", 999 }} }, // N/A patch
-		{ { "osc_2_low_sample_no.", 4095 }, {{ "osc_2_low_sample_no.", 999 }} }, // N/A patch
-	};
+		auto assignedKnob = values[assignSlot];
+		auto& knob = getValueBySlot(mode, knobSlot);
 
-	if (mode == EPatchMode::Program || prefix.find("combi_timbre") != std::string::npos)
-	{
-		for (auto& patch : allPatches)
+		// 0:Off; 1-4: Assignable Knob; 5+: assigned params
+		switch (assignedKnob)
 		{
-			auto paramName = fullParamName(patch.param.name);
-			auto* found = findParamByKey(mode, content, paramName);
-			if (found->value == patch.param.value)
-			{
-				for (auto& paramToUpdate : patch.paramsToUpdate)
-				{
-					std::string targetName = fullParamName(paramToUpdate.name);
-					auto* foundTarget = findParamByKey(mode, content, targetName);
-					foundTarget->value = paramToUpdate.value;
-				}
-			}
+		case 7: // Volume
+			knob = 100;
+			break;
+		case 10: // Expression
+			knob = 127;
+			break;
+		case 8: // Post IFX Pan
+		case 9: // Pan
+		case 13: // LPF Cutoff
+		case 14: // Resonance/HPF
+		case 15: // Filter EG Int.
+		case 16: // Filter/Amp Attack
+		case 17: // Filter/Amp Decay
+		case 18: // Filter/Amp Sustain
+		case 19: // Filter/Amp Release
+		case 20: // LFO1 Speed
+		case 21: // LFO1 Pitch Depth
+			knob = 64;
+			break;
+		default:
+			knob = 0;
 		}
 	}
 
-	// Patching knobs default value (only for program or global combi, not timber)
-	if (prefix.find("combi_timbre") == std::string::npos)
-	{
-		for (int i = 1; i <= 4; i++)
-		{
-			std::string paramName;
-			if (prefix.find("combi_") != std::string::npos)
-				paramName = utils::string_format("%sknob%d_assign_type", prefix.c_str(), i);
-			else
-				paramName = utils::string_format("%scommon_knob%d_assign_type", prefix.c_str(), i);
-
-			auto* foundAssign = findParamByKey(mode, content, paramName);
-			auto assignedKnob = foundAssign->value;
-			{
-				std::string targetName = utils::string_format("%sknob%d", prefix.c_str(), i);
-				auto* found = findParamByKey(mode, content, targetName);
-
-				// 0:Off; 1-4: Assignable Knob; 5+: assigned params
-				switch (assignedKnob)
-				{
-				case 7: // Volume
-					found->value = 100;
-					break;
-				case 10: // Expression
-					found->value = 127;
-					break;
-				case 8: // Post IFX Pan
-				case 9: // Pan
-				case 13: // LPF Cutoff
-				case 14: // Resonance/HPF
-				case 15: // Filter EG Int.
-				case 16: // Filter/Amp Attack
-				case 17: // Filter/Amp Decay
-				case 18: // Filter/Amp Sustain
-				case 19: // Filter/Amp Release
-				case 20: // LFO1 Speed
-				case 21: // LFO1 Pitch Depth
-					found->value = 64;
-					break;
-				default:
-					found->value = 0;
-				}
-			}
-		}
-	}
+	for (auto& ignored : plan.ignored)
+		getValueBySlot(mode, ignored.slot) = ignored.value;
 }
 
 void PCG_Converter::postPatchCombi(ParamList& content)
 {
-	for (auto& timbre : combi_timbres)
+	for (auto slot : getPlan(EPatchMode::Combi).timbreBankSlots)
 	{
-		auto jsonName = utils::string_format("combi_timbre_%d_program_bank", timbre.id);
-		auto* found = findParamByKey(EPatchMode::Combi, content, jsonName);
-		if (found->value >= 6 && found->value <= 16) // GM banks
-			found->value -= 2;
-		else if (found->value >= 17)
-			found->value--;
+		auto& value = getValueBySlot(EPatchMode::Combi, slot);
+		if (value >= 6 && value <= 16) // GM banks
+			value -= 2;
+		else if (value >= 17)
+			value--;
 	}
 }
 
-void PCG_Converter::patchSharedConversions(EPatchMode mode, PCG_Converter::ParamList& content, const std::string& prefix, unsigned char* data)
+void PCG_Converter::patchSharedConversions(EPatchMode mode, const SharedPlan& plan, unsigned char* data)
 {
-	for (auto& conversion : shared_conversions)
-	{
-		if (conversion.jsonParam.empty())
-			continue;
+	ScopedPhase phase(*this, EPhase::SharedConversions);
 
-		auto jsonName = utils::string_format("%s%s", prefix.c_str(), conversion.jsonParam.c_str());
-		auto pcgVal = getPCGValue(data, conversion);
-		patchValue(mode, content, jsonName, pcgVal);
-
-		if (conversion.jsonParam.find("effect_type") != std::string::npos)
-		{
-			int index = conversion.jsonParam.find("mfx1") != std::string::npos ? 1 : 2;
-			int startOffset = conversion.jsonParam.find("mfx1") != std::string::npos ? 136 : 156;
-			auto fxprefix = utils::string_format("%smfx%d", prefix.c_str(), index);
-			patchEffect(mode, content, startOffset, data, pcgVal, fxprefix);
-		}
-	}
-
-	for (auto& ifx_struct : program_ifx_offsets)
+	forEachPlannedValue(mode, plan.params, data, [&](const PlannedParam& param, int pcgVal)
 	{
-		for (auto& conversion : program_ifx_conversions)
-		{
-			if (conversion.jsonParam.empty())
-				continue;
-
-			TritonStruct info = TritonStruct(conversion);
-			info.pcgOffset += ifx_struct.startOffset;
-			if (info.pcgLSBOffset != -1)
-				info.pcgLSBOffset += ifx_struct.startOffset;
+		patchPlanned(mode, param, pcgVal);
 
-			auto jsonName = utils::string_format("%sifx%d_%s", prefix.c_str(), ifx_struct.id, conversion.jsonParam.c_str());
-			auto pcgVal = getPCGValue(data, info);
-
-			patchValue(mode, content, jsonName, pcgVal);
-
-			if (info.jsonParam.find("effect_type") != std::string::npos)
-			{
-				auto fxprefix = utils::string_format("%sifx%d", prefix.c_str(), ifx_struct.id);
-				patchEffect(mode, content, ifx_struct.startOffset, data, pcgVal, fxprefix);
-			}
-		}
-	}
+		if (param.role == PlannedParam::ERole::EffectType)
+			patchEffect(mode, plan.effects[param.effectId], data, pcgVal);
+	});
 }
 
-void PCG_Converter::patchArpeggiator(PCG_Converter::ParamList& content, const std::string& prefix,
-	const std::string& patternNoKey, unsigned char* data, EPatchMode mode)
+void PCG_Converter::patchArpeggiator(EPatchMode mode, const ArpeggiatorPlan& plan)
 {
-	auto* foundRef = findParamByKey(mode, content, patternNoKey);
-	uint32_t patternNo = foundRef->value;
+	ScopedPhase phase(*this, EPhase::Arpeggiator);
+
+	const int patternNoValue = getParams(mode).values[plan.patternNoSlot];
+	uint32_t patternNo = patternNoValue;
 
 	if (patternNo >= 0 && patternNo <= 4) // Factory patterns
 	{
-		auto patchEntry = [&](const auto& jsonName, auto val)
-		{
-			auto* found = findParamByKey(mode, content, jsonName);
-			found->value = val;
-		};
-
-		patchEntry(utils::string_format("%spattern_parameter_length", prefix.c_str()), 1);
-		patchEntry(utils::string_format("%spattern_parameter_tone_mode", prefix.c_str()), 0);
-		patchEntry(utils::string_format("%spattern_parameter_fixed_note_mode", prefix.c_str()), 0);
-
-		const int maxTones = 12;
-		for (int i = 1; i <= maxTones; i++)
-		{
-			patchEntry(utils::string_format("%spattern_parameter_tone_note_no.%d", prefix.c_str(), i), 0);
-		}
-
-		const int maxSteps = 48;
-		for (int i = 0; i < maxSteps; i++)
-		{
-			patchEntry(utils::string_format("%spattern_parameter_step_%d_gate", prefix.c_str(), i), 0);
-			patchEntry(utils::string_format("%spattern_parameter_step_%d_velocity", prefix.c_str(), i), 1);
-
-			for (int j = 0; j < maxTones; j++)
-			{
-				patchEntry(utils::string_format("%spattern_parameter_step_%d_tone_%d", prefix.c_str(), i, j), 0);
-			}
-		}
+		for (auto& [slot, value] : plan.factoryPatternValues)
+			getValueBySlot(mode, slot) = value;
 	}
 	else
 	{
 		KorgBanks* arpBanks = m_pcg->Arpeggio;
 		if (!m_pcg->Arpeggio)
 		{
-			static bool bWarnAboutArppegios = true;
-			if (bWarnAboutArppegios)
-			{
-				log("  Important: no user arpeggiator patterns are stored in this PCG -> defaulting to factory PCG\n");
-				log("  This message is only printed once.\n");
-				bWarnAboutArppegios = false;
-			}
+			logOnce(EWarning::FactoryArpeggios,
+				"  Important: no user arpeggiator patterns are stored in this PCG -> defaulting to factory PCG\n"
+				"  This message is only printed once.\n");
 			arpBanks = m_factoryPcg->Arpeggio;
 
 			if (!arpBanks)
@@ -960,61 +1642,36 @@ void PCG_Converter::patchArpeggiator(PCG_Converter::ParamList& content, const st
 
 		if (!foundBank)
 		{
-			log("  Couldn't find arp. pattern " + std::to_string(foundRef->value) + "in PCG\n");
+			log("  Couldn't find arp. pattern " + std::to_string(patternNoValue) + "in PCG\n");
 		}
 		else
 		{
-			auto* item = foundBank->item[patternNo];
-			auto* arpData = item->data;
-
-			for (auto& conversion : arpeggiator_global_conversions)
-			{
-				auto jsonName = utils::string_format("%spattern_parameter_%s", prefix.c_str(), conversion.jsonParam.c_str());
-				auto pcgVal = getPCGValue(arpData, conversion);
-				patchValue(mode, content, jsonName, pcgVal);
-			}
-
-			for (int iStep = 0; iStep < 48; iStep++)
-			{
-				for (auto& conversion : arpeggiator_step_conversions)
-				{
-					auto jsonName = utils::string_format("%spattern_parameter_step_%d_%s", prefix.c_str(), iStep, conversion.jsonParam.c_str());
-
-					TritonStruct info = TritonStruct(conversion);
-					info.pcgOffset += (6 * iStep);
-					auto pcgVal = getPCGValue(arpData, info);
-					patchValue(mode, content, jsonName, pcgVal);
-				}
-			}
+			auto* item = GetKorgItem(foundBank, patternNo);
+			patchPlannedParams(mode, plan.params, item->data);
 		}
 	}
 }
 
-void PCG_Converter::patchDrumKit(PCG_Converter::ParamList& content, const std::string& prefix, unsigned char* data, EPatchMode mode)
+void PCG_Converter::patchDrumKit(EPatchMode mode, const DrumKitPlan& plan)
 {
-	auto* foundRef = findParamByKey(mode, content, utils::string_format("%scommon_oscillator_mode", prefix.c_str()));
-	auto oscMode = foundRef->value;
+	ScopedPhase phase(*this, EPhase::DrumKit);
 
+	auto oscMode = getParams(mode).values[plan.oscillatorModeSlot];
 	if (oscMode != 2) // 0:Single 1:Double 2:Drum kit
 		return;
 
-	foundRef = findParamByKey(mode, content, utils::string_format("%sosc_1_hi_sample_no.", prefix.c_str()));
-
-	if (foundRef->value > 127)
-		foundRef->value -= 9;
+	auto& drumKitRef = getValueBySlot(mode, plan.drumKitNoSlot);
+	if (drumKitRef > 127)
+		drumKitRef -= 9;
 
-	const auto drumKitNo = foundRef->value;
+	const auto drumKitNo = drumKitRef;
 
 	KorgBanks* drumkitBanks = m_pcg->Drumkit;
 	if (!m_pcg->Drumkit)
 	{
-		static bool bWarnAboutDrumkits = true;
-		if (bWarnAboutDrumkits)
-		{
-			log("  Important: no user Drum Kits are stored in this PCG -> defaulting to factory PCG\n");
-			log("  This message is only printed once.\n");
-			bWarnAboutDrumkits = false;
-		}
+		logOnce(EWarning::FactoryDrumKits,
+			"  Important: no user Drum Kits are stored in this PCG -> defaulting to factory PCG\n"
+			"  This message is only printed once.\n");
 		drumkitBanks = m_factoryPcg->Drumkit;
 
 		if (!drumkitBanks)
@@ -1045,108 +1702,72 @@ void PCG_Converter::patchDrumKit(PCG_Converter::ParamList& content, const std::s
 	}
 	else
 	{
-		auto* item = foundBank->item[idLookup];
-		auto* drumData = item->data;
-
-		int noteId = 0;
-		for (auto& note : drumkit_notes)
-		{
-			for (auto& conversion : drumkit_conversions)
-			{
-				auto jsonName = utils::string_format("%suser_drumkit_parameter_%s_%s", prefix.c_str(), note.c_str(), conversion.jsonParam.c_str());
-
-				TritonStruct info = TritonStruct(conversion);
-				info.pcgOffset += (32 * noteId);
-				if (info.pcgLSBOffset != -1)
-					info.pcgLSBOffset += (32 * noteId);
-
-				auto pcgVal = getPCGValue(drumData, info);
-
-				if (jsonName.find("higher_bank") != std::string::npos || jsonName.find("lower_bank") != std::string::npos)
-					pcgVal = convertOSCBank(pcgVal, jsonName, data);
-
-				patchValue(mode, content, jsonName, pcgVal);
-			}
-
-			noteId++;
-		}
+		auto* item = GetKorgItem(foundBank, idLookup);
+		patchPlannedParams(mode, plan.params, item->data);
 	}
 }
 
-void PCG_Converter::patchInnerProgram(PCG_Converter::ParamList& content, const std::string& prefix, unsigned char* data,
-	const std::string& progName, EPatchMode mode)
+void PCG_Converter::patchInnerProgram(EPatchMode mode, const InnerProgramPlan& plan, unsigned char* data)
 {
-	for (auto& conversion : program_conversions)
-	{
-		if (conversion.jsonParam.empty())
-			continue;
+	ScopedPhase phase(*this, EPhase::InnerProgram);
 
-		auto jsonName = utils::string_format("%s%s", prefix.c_str(), conversion.jsonParam.c_str());
-		auto pcgVal = getPCGValue(data, conversion);
-		patchValue(mode, content, jsonName, pcgVal);
-	}
+	patchPlannedParams(mode, plan.params, data);
 
 	if (mode == EPatchMode::Program) // Program shared data (IFX, MFX, Valve..) not used in Combi mode
 	{
-		patchSharedConversions(mode, content, prefix, data);
+		auto& programPlan = getPlan(mode);
+		patchSharedConversions(mode, programPlan.shared, data);
 
 		if (m_pcg->model == EnumKorgModel::KORG_TRITON_EXTREME)
 		{
-			for (auto& conversion : triton_extreme_conversions)
-			{
-				if (conversion.jsonParam.empty())
-					continue;
-
-				auto pcgVal = getPCGValue(data, conversion);
-				auto jsonName = utils::string_format("%s%s", prefix.c_str(), conversion.jsonParam.c_str());
-
-				patchValue(mode, content, jsonName, pcgVal);
-			}
+			patchPlannedParams(mode, programPlan.extreme, data);
 		}
 		else
 		{
-			for (auto& conversion : triton_extreme_conversions)
-			{
-				auto jsonName = utils::string_format("%s%s", prefix.c_str(), conversion.jsonParam.c_str());
-				patchValue(mode, content, jsonName, 0);
-			}
-
+			for (auto& param : programPlan.extreme)
+				patchPlanned(mode, param, 0);
 		}
 	}
 
-	static const int NUM_OSC = 2;
-	for (int iOscId = 0; iOscId < NUM_OSC; iOscId++)
-	{
-		for (auto& conversion : program_osc_conversions)
-		{
-			if (conversion.jsonParam.empty())
-				continue;
-
-			TritonStruct info = TritonStruct(conversion);
-			if (iOscId == 1)
-			{
-				info.pcgOffset += 154;
-				if (info.pcgLSBOffset != -1)
-					info.pcgLSBOffset += 154;
-			}
-
-			auto jsonName = utils::string_format("%sosc_%d_%s", prefix.c_str(), iOscId + 1, conversion.jsonParam.c_str());
-			auto pcgVal = getPCGValue(data, info);
+	patchPlannedParams(mode, plan.osc, data);
+}
 
-			if (jsonName.find("hi_bank") != std::string::npos || jsonName.find("low_bank") != std::string::npos)
-				pcgVal = convertOSCBank(pcgVal, jsonName, data);
+void PCG_Converter::patchTimbreProgram(const InnerProgramPlan& plan, unsigned char* data)
+{
+	ScopedPhase phase(*this, EPhase::InnerProgram);
+	const auto mode = EPatchMode::Combi;
 
-			patchValue(mode, content, jsonName, pcgVal);
-		}
+	auto& rawValues = m_timbreProgramCache[data];
+	if (rawValues.empty())
+	{
+		rawValues.resize(plan.params.size() + plan.osc.size());
+		getPlannedRawValues(data, plan.params.data(), plan.params.size(), rawValues.data());
+		getPlannedRawValues(data, plan.osc.data(), plan.osc.size(), rawValues.data() + plan.params.size());
 	}
+
+	// Every timbre plan is built from the same conversions, in the same order
+	assert(rawValues.size() == plan.params.size() + plan.osc.size());
+	auto rawValue = rawValues.begin();
+	for (auto& param : plan.params)
+		patchPlanned(mode, param, convertPlannedValue(mode, param, *rawValue++, data));
+	for (auto& param : plan.osc)
+		patchPlanned(mode, param, convertPlannedValue(mode, param, *rawValue++, data));
 }
 
 void PCG_Converter::patchCombiToJson(int bankId, int presetId,
 	const std::string& presetName, unsigned char* data, const std::string& userFolder, const std::string& targetLetter)
 {
 	auto outFilePath = getOutputPatchPath(presetId, userFolder);
-	std::ofstream json(outFilePath);
+	std::ofstream json;
+	{
+		ScopedPhase phase(*this, EPhase::FileIO);
+		json.open(outFilePath);
+	}
+
 	patchCombiToStream(bankId, presetId, presetName, data, targetLetter, json);
+
+	ScopedPhase phase(*this, EPhase::FileIO);
+	json.close();
 }
 
 void PCG_Converter::patchToStream(EPatchMode mode, int bankId, int presetId, const std::string& presetName, unsigned char* data,
@@ -1166,67 +1787,49 @@ void PCG_Converter::patchCombiToStream(int bankId, int presetId, const std::stri
 		const std::string& targetLetter, std::ostream& out_stream)
 {
 	auto& content = m_dictCombiParams;
-	const auto mode = EPatchMode::Combi;
+	auto timbersToWrite = patchCombi(data);
 
-	for (auto& conversion : combi_conversions)
-	{
-		if (conversion.jsonParam.empty())
-			continue;
+	auto bankNumber = Helpers::getVSTBankNumber(EPatchMode::Combi, targetLetter, m_targetModel);
 
-		auto pcgVal = getPCGValue(data, conversion);
-		patchValue(mode, content, conversion.jsonParam, pcgVal);
-	}
+	ScopedPhase phase(*this, EPhase::JsonWrite, &out_stream);
+	jsonWriteHeaderBegin(out_stream, presetName, EPatchMode::Combi, m_targetModel, content);
+	jsonWriteTimbers(out_stream, timbersToWrite);
+	jsonWriteHeaderEnd(out_stream, presetId, bankNumber, targetLetter, "Combi");
+	jsonWriteDSPSettings(out_stream, content);
 
-	patchSharedConversions(mode, content, "combi_", data);
+	jsonWriteEnd(out_stream, "combi");
+}
 
-	for (auto& conversion : triton_extreme_conversions)
-	{
-		if (conversion.jsonParam.empty())
-			continue;
+std::vector<PCG_Converter::Timber> PCG_Converter::patchCombi(unsigned char* data)
+{
+	auto& content = m_dictCombiParams;
+	const auto mode = EPatchMode::Combi;
+	auto& plan = getPlan(mode);
 
-		auto jsonName = utils::string_format("combi_%s", conversion.jsonParam.c_str());
-		auto pcgVal = getPCGValue(data, conversion);
-		patchValue(mode, content, jsonName, pcgVal);
-	}
+	content.reset();
+	patchPlannedParams(mode, plan.combi, data);
+
+	patchSharedConversions(mode, plan.shared, data);
+
+	patchPlannedParams(mode, plan.extreme, data);
 
 	std::array<PCG_Converter::Prog, 8> associatedPrograms;
 
-	for (auto& timbre : combi_timbres)
+	for (size_t iTimbre = 0; iTimbre < plan.timbres.size(); iTimbre++)
 	{
-		for (auto& conversion : combi_timbre_conversions)
+		forEachPlannedValue(mode, plan.timbres[iTimbre], data, [&](const PlannedParam& param, int pcgVal)
 		{
-			if (conversion.jsonParam.empty())
-				continue;
-
-			auto jsonName = utils::string_format("combi_timbre_%d_%s", timbre.id, conversion.jsonParam.c_str());
-
-			TritonStruct timbreInfo = TritonStruct(conversion);
-			timbreInfo.pcgOffset += timbre.startOffset;
-			if (timbreInfo.pcgLSBOffset != -1)
-			{
-				timbreInfo.pcgLSBOffset += timbre.startOffset;
-			}
-
-			auto pcgVal = getPCGValue(data, timbreInfo);
-
-			if (jsonName.find("hi_bank") != std::string::npos || jsonName.find("low_bank") != std::string::npos)
-				pcgVal = convertOSCBank(pcgVal, jsonName, data);
-
-			patchValue(mode, content, jsonName, pcgVal);
+			patchPlanned(mode, param, pcgVal);
 
-			if (conversion.jsonParam.find("program_no") != std::string::npos)
-			{
-				associatedPrograms[timbre.id - 1].program = pcgVal;
-			}
-			else if (conversion.jsonParam.find("program_bank") != std::string::npos)
-			{
-				associatedPrograms[timbre.id - 1].bank = pcgVal;
-			}
-		}
+			if (param.role == PlannedParam::ERole::TimbreProgram)
+				associatedPrograms[iTimbre].program = pcgVal;
+			else if (param.role == PlannedParam::ERole::TimbreBank)
+				associatedPrograms[iTimbre].bank = pcgVal;
+		});
 	}
 
 	// Global fields to patch (IFX...)
-	patchProgramUnusedValues(mode, content, "combi_");
+	patchUnusedValues(mode, plan.unusedValues);
 
 	std::vector<Timber> timbersToWrite;
 
@@ -1234,52 +1837,46 @@ void PCG_Converter::patchCombiToStream(int bankId, int presetId, const std::stri
 	for (auto& prog : associatedPrograms)
 	{
 		std::string programName = "Unknown";
-		auto prefix = utils::string_format("combi_timbre_%d_", iTimber + 1);
 
 		auto processed = false;
 		auto* progBank = findDependencyBank(m_pcg, prog.bank);
 		if (!progBank)
 		{
-			static bool bWarnAboutFactoryBanks = true;
-			if (bWarnAboutFactoryBanks)
-			{
-				if (!m_pcg->Program)
-					log("  Important: this PCG doesn't contain any Programs -> defaulting to factory PCG\n");
-				else {
-					auto msg = "  Important: the program dependency (timber " + std::to_string(iTimber) + ": "
-						+ std::to_string(prog.bank) + ":" + std::to_string(prog.program) + ") couldn't be found on this PCG -> defaulting to factory PCG\n";
-					log(msg);
-				}
-				log("  This message is only printed once.\n");
-				bWarnAboutFactoryBanks = false;
-			}
+			std::string msg;
+			if (!m_pcg->Program)
+				msg = "  Important: this PCG doesn't contain any Programs -> defaulting to factory PCG\n";
+			else
+				msg = "  Important: the program dependency (timber " + std::to_string(iTimber) + ": "
+					+ std::to_string(prog.bank) + ":" + std::to_string(prog.program) + ") couldn't be found on this PCG -> defaulting to factory PCG\n";
+
+			logOnce(EWarning::FactoryPrograms, msg + "  This message is only printed once.\n");
 
 			progBank = findDependencyBank(m_factoryPcg, prog.bank);
 		}
 
 		if (progBank)
 		{
-			auto* progItem = progBank->item[prog.program];
+			auto* progItem = GetKorgItem(progBank, prog.program);
 			auto depProgName = std::string((char*)progItem->data, 16);
-			patchInnerProgram(content, prefix, progItem->data, depProgName, EPatchMode::Combi);
+			patchTimbreProgram(plan.timbrePrograms[iTimber], progItem->data);
 			programName = depProgName;
 			processed = true;
 		}
 		else if (Helpers::isGMBank(prog.bank))
 		{
 			// GM Banks are not saved in the PCG, we need to retrieve it ourselves
-			auto found = std::find_if(m_mappedGMInfo.begin(), m_mappedGMInfo.end(), [&](auto& e) { return prog.bank == e.bankId && prog.program == e.programId; });
-			if (found == m_mappedGMInfo.end() && prog.bank > 6)
+			auto dataOffset = m_resources->findGMProgramOffset(prog.bank, prog.program);
+			if (dataOffset < 0 && prog.bank > kGMFirstBankId)
 			{
 				// No specific variation for that GM bank, try to fallback to regular GM bank instead
-				found = std::find_if(m_mappedGMInfo.begin(), m_mappedGMInfo.end(), [&](auto& e) { return e.bankId == 6 && prog.program == e.programId; });
+				dataOffset = m_resources->findGMProgramOffset(kGMFirstBankId, prog.program);
 			}
 			
-			if (found != m_mappedGMInfo.end())
+			if (dataOffset >= 0)
 			{
-				unsigned char* data = (unsigned char*)m_gmData.data() + found->dataOffset;
+				unsigned char* data = (unsigned char*)m_resources->gmData + dataOffset;
 				auto depProgName = std::string((char*)data, 16);
-				patchInnerProgram(content, prefix, data, depProgName, EPatchMode::Combi);
+				patchTimbreProgram(plan.timbrePrograms[iTimber], data);
 				programName = depProgName;
 				processed = true;
 			}
@@ -1294,9 +1891,8 @@ void PCG_Converter::patchCombiToStream(int bankId, int presetId, const std::stri
 		}
 		else
 		{
-			patchDrumKit(content, prefix, data, mode);
-			patchProgramUnusedValues(mode, content, prefix);
-			patchCombiUnusedValues(content, prefix);
+			patchDrumKit(mode, plan.timbrePrograms[iTimber].drumKit);
+			patchUnusedValues(mode, plan.timbreUnusedValues[iTimber]);
 		}
 
 		auto timberBankName = Helpers::getVSTProgramBankName(prog.bank, m_targetModel);
@@ -1305,31 +1901,17 @@ void PCG_Converter::patchCombiToStream(int bankId, int presetId, const std::stri
 		iTimber++;
 	}
 
-	// Arpeggiators
-	for (int i = 0; i < 2; i++)
-	{
-		auto arp_letter = i == 0 ? "a" : "b";
-		auto prefix = utils::string_format("combi_user_arp_%s_", arp_letter);
-		auto patternJsonName = utils::string_format("combi_arpeggiator_%s_pattern_no.", arp_letter);
-		patchArpeggiator(content, prefix, patternJsonName, data, EPatchMode::Combi);
-	}
+	// Arpeggiators A and B
+	for (auto& arpeggiator : plan.arpeggiators)
+		patchArpeggiator(mode, arpeggiator);
 
 	postPatchCombi(content);
 
-	auto bankNumber = Helpers::getVSTBankNumber(EPatchMode::Combi, targetLetter, m_targetModel);
-
-	jsonWriteHeaderBegin(out_stream, presetName, EPatchMode::Combi, m_targetModel, content);
-	jsonWriteTimbers(out_stream, timbersToWrite);
-	jsonWriteHeaderEnd(out_stream, presetId, bankNumber, targetLetter, "Combi");
-	jsonWriteDSPSettings(out_stream, content);
-
-	jsonWriteEnd(out_stream, "combi");
+	return timbersToWrite;
 }
 
-void PCG_Converter::convertProgramJsonToBin(PCG_Converter::ParamList& content, const std::string& programName, std::ostream& outStream)
+void PCG_Converter::convertProgramJsonToBin(const PCG_Converter::ParamList& content, const std::string& programName, std::ostream& outStream)
 {
-	auto mode = EPatchMode::Program;
-
 	constexpr int bufferSize = CustomProgramBufferSize;
 	char buffer[bufferSize];
 	memset(buffer, 0x20, 16);
@@ -1355,31 +1937,33 @@ void PCG_Converter::convertProgramJsonToBin(PCG_Converter::ParamList& content, c
 		return (firstByte << 16 | secondByte << 8 | thirdByte);
 	};
 
-	auto saveValue = [&](auto& jsonName, auto& conversion)
+	auto saveValue = [&](auto& jsonName, auto& conversion, int baseOffset = 0)
 	{
-		auto* found = findParamByKey(mode, content, jsonName);
-		int offset = conversion.pcgOffset;
+		auto slot = content.layout->findSlot(jsonName);
+		assert(slot >= 0);
+		const auto* found = &content.values[slot];
+		int offset = baseOffset + conversion.pcgOffset;
 
 		if (conversion.third.has_value())
 		{
-			unsigned int temp = swapThreeBytes(found->value << conversion.third->bit_start);
+			unsigned int temp = swapThreeBytes(*found << conversion.third->bit_start);
 			int* dest = (int*)(buffer + offset);
 			*dest |= temp;
 		}
 		else if (conversion.pcgLSBOffset >= 0)
 		{
-			unsigned short temp = swapTwoBytes(found->value << conversion.pcgLSBBitStart);
+			unsigned short temp = swapTwoBytes(*found << conversion.pcgLSBBitStart);
 			short* dest = (short*)(buffer + offset);
 			*dest |= temp;
 		}
 		else
 		{
-			unsigned char temp = found->value << conversion.pcgBitStart;
+			unsigned char temp = *found << conversion.pcgBitStart;
 			char* dest = buffer + offset;
 			*dest |= temp;
 		}
 
-		return found->value;
+		return *found;
 	};
 
 	auto saveEffet = [&](auto effectId, auto& fxPrefix, auto startOffset)
@@ -1387,24 +1971,10 @@ void PCG_Converter::convertProgramJsonToBin(PCG_Converter::ParamList& content, c
 		if (effectId == 0) // No effect
 			return;
 
-		auto foundEntry = effect_conversions.find(effectId);
-		if (foundEntry != effect_conversions.end())
+		for (const auto& spec_conv : getEffectConversions(effectId))
 		{
-			for (const auto& spec_conv : foundEntry->second)
-			{
-				if (spec_conv.jsonParam.empty())
-					continue;
-
-				auto info = TritonStruct(spec_conv);
-				info.pcgOffset += startOffset;
-				if (info.pcgLSBOffset != -1)
-					info.pcgLSBOffset += startOffset;
-				if (info.third.has_value())
-					info.third->offset += startOffset;
-
-				auto jsonName = utils::string_format("%s_specific_parameter_%s", fxPrefix.c_str(), spec_conv.jsonParam.c_str());
-				saveValue(jsonName, info);
-			}
+			auto jsonName = fxPrefix + "_specific_parameter_" + std::string(spec_conv.jsonParam);
+			saveValue(jsonName, spec_conv, startOffset);
 		}
 	};
 
@@ -1443,15 +2013,10 @@ void PCG_Converter::convertProgramJsonToBin(PCG_Converter::ParamList& content, c
 			if (conversion.jsonParam.empty())
 				continue;
 
-			TritonStruct info = TritonStruct(conversion);
-			info.pcgOffset += ifx_struct.startOffset;
-			if (info.pcgLSBOffset != -1)
-				info.pcgLSBOffset += ifx_struct.startOffset;
-
 			auto jsonName = utils::string_format("%sifx%d_%s", prefix.c_str(), ifx_struct.id, conversion.jsonParam.c_str());
-			auto val = saveValue(jsonName, info);
+			auto val = saveValue(jsonName, conversion, ifx_struct.startOffset);
 
-			if (info.jsonParam.find("effect_type") != std::string::npos)
+			if (conversion.jsonParam.find("effect_type") != std::string::npos)
 			{
 				auto fxprefix = utils::string_format("%sifx%d", prefix.c_str(), ifx_struct.id);
 				saveEffet(val, fxprefix, ifx_struct.startOffset);
@@ -1467,16 +2032,8 @@ void PCG_Converter::convertProgramJsonToBin(PCG_Converter::ParamList& content, c
 			if (conversion.jsonParam.empty())
 				continue;
 
-			TritonStruct info = TritonStruct(conversion);
-			if (iOscId == 1)
-			{
-				info.pcgOffset += 154;
-				if (info.pcgLSBOffset != -1)
-					info.pcgLSBOffset += 154;
-			}
-
 			auto jsonName = utils::string_format("%sosc_%d_%s", prefix.c_str(), iOscId + 1, conversion.jsonParam.c_str());
-			saveValue(jsonName, info);
+			saveValue(jsonName, conversion, (iOscId == 1) ? 154 : 0);
 		}
 	}
 
@@ -1485,21 +2042,17 @@ void PCG_Converter::convertProgramJsonToBin(PCG_Converter::ParamList& content, c
 
 void PCG_Converter::utils_convertGMProgramsToBin(const std::string& sourceFolder, const std::string& outFile)
 {
-	std::ofstream os(outFile, std::ofstream::binary);
+	assert(m_initialized); // Uses the templates and the current GM data
 
-	uint8_t presetsCount = 0;
-	auto writeInt = [](std::ostream& os, auto val) { os.write(reinterpret_cast<const char*>(&val), sizeof(val)); };
-	writeInt(os, presetsCount);
+	// Records of the v2 file, found by trimmed name: the programs of sourceFolder first
+	std::vector<std::pair<EGMRecordKind, std::string>> records;
+	std::unordered_map<std::string, int> recordsByName;
 
 	for (const auto& entry : std::filesystem::directory_iterator(sourceFolder))
 	{
 		if (!entry.is_regular_file() || entry.path().extension() != ".patch")
 			continue;
 
-		auto filename = entry.path().filename().string();
-		auto pcg_bank = atoi(filename.substr(0, 2).c_str());
-		auto pcg_program = atoi(filename.substr(3, 3).c_str());
-
 		rapidjson::Document tempDoc;
 
 		std::ifstream ifs(entry.path().string());
@@ -1509,25 +2062,74 @@ void PCG_Converter::utils_convertGMProgramsToBin(const std::string& sourceFolder
 		tempDoc.ParseStream(refisw);
 
 		ParamList allParams;
+		allParams.init(m_resources->programLayout);
 
 		auto dspSettings = tempDoc["dsp_settings"].GetArray();
 		for (auto& setting : dspSettings)
 		{
-			auto key = setting["key"].GetString();
-			auto id = setting["index"].GetInt();
-			allParams[id] = ProgParam(key, setting["value"].GetInt());
+			auto slot = m_resources->programLayout.findSlot(setting["key"].GetString());
+			if (slot >= 0)
+				allParams.write(slot) = setting["value"].GetInt();
 		}
 
-		writeInt(os, (uint8_t)pcg_bank);
-		writeInt(os, (uint8_t)pcg_program);
-		constexpr int programSize = CustomProgramBufferSize;
-		writeInt(os, (uint16_t)programSize);
-
+		std::ostringstream programStream;
 		std::string programName = tempDoc["general_program_information"]["name"].GetString();
-		convertProgramJsonToBin(allParams, programName, os);
-		presetsCount++;
+		convertProgramJsonToBin(allParams, programName, programStream);
+
+		auto program = programStream.str();
+		assert(program.size() == CustomProgramBufferSize);
+		if (recordsByName.emplace(trimGMName(program.substr(0, 16)), static_cast<int>(records.size())).second)
+			records.emplace_back(EGMRecordKind::Program, std::move(program));
+	}
+
+	// The VST doesn't export drum kits: they (and any program missing from sourceFolder) come from the current GM data
+	for (auto& record : listGMRecords(m_resources->gmData, m_resources->gmDataSize))
+	{
+		if (recordsByName.emplace(record.name, static_cast<int>(records.size())).second)
+			records.emplace_back(record.kind, std::string(m_resources->gmData + record.offset, record.size));
+	}
+
+	std::vector<int> recordIds(kGMBankCount * kGMProgramCount, -1);
+	mapGMPrograms(recordsByName, recordIds);
+
+	std::vector<GMProgramsEntry> entries;
+	for (int i = 0; i < static_cast<int>(recordIds.size()); i++)
+	{
+		if (recordIds[i] < 0)
+			continue;
+
+		auto& record = records[recordIds[i]];
+		GMProgramsEntry entry = {};
+		entry.bankId = static_cast<uint8_t>(kGMFirstBankId + i / kGMProgramCount);
+		entry.programId = static_cast<uint8_t>(i % kGMProgramCount);
+		entry.kind = record.first;
+		entry.size = static_cast<uint32_t>(record.second.size());
+		entries.push_back(entry);
 	}
 
-	os.seekp(0);
-	writeInt(os, presetsCount);
+	// Records are written in order, after the index
+	std::vector<uint32_t> recordOffsets(records.size());
+	uint32_t offset = static_cast<uint32_t>(sizeof(GMProgramsHeader) + entries.size() * sizeof(GMProgramsEntry));
+	for (size_t i = 0; i < records.size(); i++)
+	{
+		recordOffsets[i] = offset;
+		offset += static_cast<uint32_t>(records[i].second.size());
+	}
+
+	size_t iEntry = 0;
+	for (int i = 0; i < static_cast<int>(recordIds.size()); i++)
+	{
+		if (recordIds[i] >= 0)
+			entries[iEntry++].offset = recordOffsets[recordIds[i]];
+	}
+
+	GMProgramsHeader header = {};
+	memcpy(header.magic, kGMProgramsMagic, sizeof(kGMProgramsMagic));
+	header.entryCount = static_cast<uint32_t>(entries.size());
+
+	std::ofstream os(outFile, std::ofstream::binary);
+	os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	os.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(GMProgramsEntry));
+	for (auto& record : records)
+		os.write(record.second.data(), record.second.size());
 }
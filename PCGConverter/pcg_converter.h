@@ -2,21 +2,30 @@
 
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <assert.h>
 #include <functional>
 #include <optional>
 #include <map>
+#include <unordered_map>
+#include <array>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
 
 struct KorgPCG;
 struct KorgBank;
+struct KorgMappedFile;
 enum class EnumKorgModel : uint8_t;
 enum class EPatchMode : uint8_t;
 enum class EVarType : uint8_t { Signed, Unsigned };
 
 struct Byte
 {
-	Byte(int inOffset, int inBitStart, int inBitEnd)
+	constexpr Byte(int inOffset, int inBitStart, int inBitEnd)
 		: offset(inOffset)
 		, bit_start(inBitStart)
 		, bit_end(inBitEnd)
@@ -43,6 +52,61 @@ struct TritonStruct
 	std::optional<Byte> third;
 };
 
+// Sign extends the low bits of value: shift is 32 minus their count. 0 returns value unchanged
+constexpr int signExtendWithShift(int value, int shift)
+{
+	return static_cast<int>(static_cast<unsigned>(value) << shift) >> shift;
+}
+
+// The PCG stores signed values on 2 to 13 bits and 16 bits: values of other widths are read as they are
+constexpr int signExtensionShift(int numBits)
+{
+	return ((numBits >= 2 && numBits <= 13) || numBits == 16) ? 32 - numBits : 0;
+}
+
+template<int Bits>
+constexpr int signExtend(int value)
+{
+	static_assert(Bits > 0 && Bits <= 32, "Invalid bit count");
+	return signExtendWithShift(value, signExtensionShift(Bits));
+}
+
+// A TritonStruct compiled against the offset of its data: its bit fields are read without any branch on the layout
+struct PCGField
+{
+	struct Part
+	{
+		int offset = 0;
+		uint8_t shift = 0;
+		uint8_t mask = 0;
+		uint8_t width = 0; // The previous parts are shifted by this many bits
+		bool isSigned = false;
+	};
+
+	std::array<Part, 3> parts; // MSB first
+	uint8_t partCount = 0;
+	uint8_t signShift = 0; // See signExtensionShift, 0 when unsigned
+};
+
+// Constant counterpart of TritonStruct, for the effect tables
+struct EffectConversion
+{
+	std::string_view desc;
+	std::string_view jsonParam;
+	int pcgOffset = 0;
+	int pcgBitStart = 0;
+	int pcgBitEnd = 0;
+	EVarType varType = EVarType::Signed;
+
+	int pcgLSBOffset = -1;
+	int pcgLSBBitStart = -1;
+	int pcgLSBBitEnd = -1;
+
+	std::optional<Byte> third;
+
+	int effectType = 0; // Only set on the markers starting the conversions of an effect type
+};
+
 struct SubParam
 {
 	int id = 0;
@@ -60,24 +124,24 @@ public:
 
 	PCG_Converter(const PCG_Converter& other, const std::string destFolder);
 
+	// Converts another PCG with the resources and factory PCG already loaded by core.
+	// core is only read: several converters can share it from different threads
+	PCG_Converter(
+		const PCG_Converter& core,
+		KorgPCG* pcg,
+		const std::string destFolder,
+		std::function<void(const std::string&)>&& func = {});
+	PCG_Converter(const PCG_Converter&) = delete;
+	PCG_Converter& operator=(const PCG_Converter&) = delete;
+
 	bool isInitialized() const { return m_initialized; }
 
+	// Number of threads used by convertPrograms/convertCombis (1: sequential)
+	void setWorkerCount(uint32_t count) { m_workerCount = count > 0 ? count : 1; }
+
 	void convertPrograms(const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds);
 	void convertCombis(const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds);
 
-	struct ProgParam
-	{
-		ProgParam() = default;
-
-		ProgParam(std::string&& inKey, int inValue)
-			: key(std::move(inKey))
-			, value(inValue)
-		{}
-
-		std::string key;
-		int value = 0;
-	};
-
 	struct Prog
 	{
 		int bank = -1;
@@ -97,32 +161,270 @@ public:
 	void patchToStream(EPatchMode mode, int bankId, int presetId, const std::string& presetName, unsigned char* data,
 		const std::string& targetLetter, std::ostream& out_stream);
 
-	static int getPCGValue(unsigned char* data, TritonStruct& info);
+	// The offsets of info are relative to data + baseOffset
+	static int getPCGValue(const unsigned char* data, const TritonStruct& info, int baseOffset = 0);
+
+	static PCGField compileField(const TritonStruct& info, int dataOffset = 0);
+	static PCGField compileField(const EffectConversion& info, int dataOffset = 0);
+
+	static constexpr int kEffectTypeCount = 103; // IFX/MFX types, 0: no effect
+	static int getFieldValue(const unsigned char* data, const PCGField& field);
 
 	void utils_convertGMProgramsToBin(const std::string& sourceFolder, const std::string& outFile);
 
+	// Folder of the templates, GM data and factory PCGs
+	static std::string getDataFolder();
+
+	// Opt-in timings and counters of the conversion phases. Phase times include their nested phases
+	enum class EPhase : uint8_t
+	{
+		Templates, FactoryData, InnerProgram, SharedConversions, Effect, Arpeggiator, DrumKit,
+		DependencyLookup, JsonWrite, FileIO, Count
+	};
+
+	struct PhaseStats
+	{
+		uint64_t calls = 0;
+		uint64_t nanoseconds = 0;
+		uint64_t paramsWritten = 0;
+		uint64_t bytesWritten = 0;
+	};
+	typedef std::array<PhaseStats, static_cast<size_t>(EPhase::Count)> PhaseReport;
+
+	// Applies to all converters: set it before creating them
+	static void setInstrumentation(bool enabled) { m_instrumented = enabled; }
+	const PhaseReport& getPhaseReport() const { return m_phaseReport; }
+
+	static void addPhaseReport(PhaseReport& to, const PhaseReport& from);
+	static void writePhaseReport(std::ostream& out, const PhaseReport& report);
+	static void writePhaseReportJson(std::ostream& out, const PhaseReport& report);
+
 private:
+	friend class PCG_ConverterBenchmark; // Times the private stages one by one
+
+	enum class EWarning : uint8_t { FactoryArpeggios, FactoryDrumKits, FactoryPrograms, Count };
+
+	struct LogEntry
+	{
+		std::string text;
+		std::optional<EWarning> warning;
+	};
+
+	class ScopedPhase
+	{
+	public:
+		ScopedPhase(PCG_Converter& converter, EPhase phase, std::ostream* output = nullptr);
+		~ScopedPhase();
+
+	private:
+		PCG_Converter* m_converter = nullptr; // Null when instrumentation is off
+		EPhase m_phase;
+		std::chrono::steady_clock::time_point m_start;
+		uint64_t m_paramWrites = 0;
+		std::ostream* m_output = nullptr; // Its growth is counted as bytes written
+		std::streamoff m_outputStart = -1;
+	};
+
 	void log(const std::string& text);
+	void logOnce(EWarning warning, const std::string& text);
 	void error(const std::string& text);
+	void flushLog(const std::vector<LogEntry>& entries);
 
-	bool retrieveTemplatesData();
-	bool retrieveGMData();
+	struct ConversionJob
+	{
+		KorgBank* bank = nullptr;
+		uint32_t presetId = 0;
+		std::string userFolder;
+		std::string targetLetter;
+	};
+
+	void convertBanks(EPatchMode mode, const std::vector<std::string>& letters, const std::vector<int>& targetLetterIds);
+	void convertJob(EPatchMode mode, const ConversionJob& job);
+	void convertJobsParallel(EPatchMode mode, const std::vector<ConversionJob>& jobs);
+
+	struct ConverterResources;
+	bool retrieveResources();
+	bool retrieveTemplatesData(ConverterResources& out_resources);
+	bool retrieveGMData(ConverterResources& out_resources);
 	bool retrieveFactoryPCG();
 
-	typedef std::map<int, ProgParam> ParamList;
-	void patchInnerProgram(ParamList& content, const std::string& prefix, unsigned char* data, const std::string& progName, EPatchMode mode);
-	void patchSharedConversions(EPatchMode mode, ParamList& content, const std::string& prefix, unsigned char* data);
-	void patchEffect(EPatchMode mode, ParamList& content, int dataOffset, unsigned char* data, int effectId, const std::string& prefix);
-	void patchArpeggiator(ParamList& content, const std::string& prefix, const std::string& patternNoKey, unsigned char* data, EPatchMode mode);
-	void patchDrumKit(ParamList& content, const std::string& prefix, unsigned char* data, EPatchMode mode);
+	// Keys of a patch template, interned once. Params are addressed by slot: their position in the template, sorted by index
+	struct ParamLayout
+	{
+		std::vector<int> ids; // Template index
+		std::vector<std::string> keys;
+		std::vector<int> defaultValues;
+		std::map<std::string, int> keyToSlot;
+
+		// Constant part of each dsp_settings entry: {"index": N, "key": "K", "value": 
+		std::string jsonPrefixes;
+		std::vector<size_t> jsonPrefixOffsets; // Slot count + 1 offsets into jsonPrefixes
+
+		void addParam(int id, const std::string& key, int defaultValue);
+		int findSlot(const std::string& key) const;
+		int findSlotById(int id) const;
+	};
+
+	// Params of the preset being converted: the template defaults, overlaid with the slots written since the last reset
+	struct ParamList
+	{
+		const ParamLayout* layout = nullptr;
+		std::vector<int> values; // Indexed by slot
+		std::vector<int> writtenSlots;
+		std::vector<bool> written; // Indexed by slot
+
+		void init(const ParamLayout& inLayout);
+		int& write(int slot);
+		void reset(); // Back to the template defaults, only the written slots are restored
+	};
+
+	static bool readTemplateCache(const std::string& templatePath, const std::string& cachePath, ParamLayout& out_layout);
+	static void writeTemplateCache(const std::string& templatePath, const std::string& cachePath, const ParamLayout& layout);
+
+	const ParamLayout& getLayout(EPatchMode mode) const;
+	ParamList& getParams(EPatchMode mode);
+	int& getValueBySlot(EPatchMode mode, int slot);
+
+	// Conversion tables resolved once against the template keys, so that presets are patched without building any key
+	struct PlannedParam
+	{
+		enum class ERole : uint8_t { None, OSCBank, EffectType, TimbreProgram, TimbreBank };
+
+		const TritonStruct* conversion = nullptr; // Null for effect params
+		PCGField field; // The conversion, offset to the data of the param
+		int slot = -1;
+		ERole role = ERole::None;
+		int effectId = -1; // EffectType: index of the effect in SharedPlan::effects
+	};
+	typedef std::vector<PlannedParam> PlannedParams;
+
+	struct EffectPlan
+	{
+		std::vector<std::optional<PlannedParams>> paramsByType; // Indexed by effect type
+	};
+
+	struct SharedPlan
+	{
+		PlannedParams params; // MFX, master EQ, IFX
+		std::vector<EffectPlan> effects; // MFX1, MFX2, IFX1-5
+	};
+
+	// User drum kit played by a program: the drum kit conversions of each note, 32 bytes apart
+	struct DrumKitPlan
+	{
+		int oscillatorModeSlot = -1;
+		int drumKitNoSlot = -1; // OSC 1 high multisample
+		PlannedParams params; // Note after note, bank params have the OSCBank role
+	};
+
+	struct InnerProgramPlan
+	{
+		PlannedParams params;
+		PlannedParams osc;
+		DrumKitPlan drumKit;
+	};
+
+	// User arpeggiator pattern: the global conversions, then the step conversions of each step, 6 bytes apart
+	struct ArpeggiatorPlan
+	{
+		int patternNoSlot = -1;
+		PlannedParams params;
+		std::vector<std::pair<int, int>> factoryPatternValues; // Slot and value of the params reset by factory patterns
+	};
+
+	// Values that the VST expects but that a preset doesn't store, fixed once its conversions are done
+	struct UnusedValuesPlan
+	{
+		struct SlotValue
+		{
+			int slot = -1;
+			int value = 0;
+		};
+
+		// target is set when source has its value. Program and combi timbres only
+		std::vector<std::pair<SlotValue, SlotValue>> fixups;
+		// Default value of each knob, from its assign type. Program and global combi only
+		std::vector<std::pair<int, int>> knobs; // Assign type slot, knob slot
+		std::vector<SlotValue> ignored; // Combi timbres only
+	};
+
+	struct ConversionPlan
+	{
+		SharedPlan shared;
+		PlannedParams extreme;
+		std::vector<ArpeggiatorPlan> arpeggiators; // Program: 1, Combi: A and B
+		UnusedValuesPlan unusedValues;
+
+		InnerProgramPlan program; // Program only
+
+		PlannedParams combi; // Combi only
+		std::vector<PlannedParams> timbres;
+		std::vector<InnerProgramPlan> timbrePrograms;
+		std::vector<UnusedValuesPlan> timbreUnusedValues;
+		std::vector<int> timbreBankSlots;
+	};
+
+	// Templates, conversion plans and GM data. Built once by the first converter, then only read: every converter
+	// of the process shares them, from any thread
+	struct ConverterResources
+	{
+		ParamLayout programLayout;
+		ParamLayout combiLayout;
+
+		ConversionPlan programPlan;
+		ConversionPlan combiPlan;
+
+		KorgMappedFile* gmFile = nullptr; // nullptr when the GM data is embedded
+		const char* gmData = nullptr;
+		size_t gmDataSize = 0;
+
+		// Offset in gmData of each (GM bank, program), -1 when the GM data doesn't have it
+		std::vector<int> gmProgramOffsets;
+
+		ConverterResources() = default;
+		ConverterResources(const ConverterResources&) = delete;
+		ConverterResources& operator=(const ConverterResources&) = delete;
+		~ConverterResources();
+
+		const ParamLayout& getLayout(EPatchMode mode) const;
+		const ConversionPlan& getPlan(EPatchMode mode) const;
+		int findGMProgramOffset(int bankId, int programId) const;
+
+		void initConversionPlans();
+		int findSlot(EPatchMode mode, const std::string& key) const;
+		void planParams(EPatchMode mode, PlannedParams& out, const std::vector<TritonStruct>& conversions,
+			const std::string& prefix, int dataOffset = 0) const;
+		void planEffect(EPatchMode mode, EffectPlan& out, const std::string& prefix, int dataOffset) const;
+		void planShared(EPatchMode mode, SharedPlan& out, const std::string& prefix) const;
+		void planInnerProgram(EPatchMode mode, InnerProgramPlan& out, const std::string& prefix) const;
+		void planDrumKit(EPatchMode mode, DrumKitPlan& out, const std::string& prefix) const;
+		void planArpeggiator(EPatchMode mode, ArpeggiatorPlan& out, const std::string& prefix, const std::string& patternNoKey) const;
+		void planUnusedValues(EPatchMode mode, UnusedValuesPlan& out, const std::string& prefix) const;
+	};
+
+	const ConversionPlan& getPlan(EPatchMode mode) const { return m_resources->getPlan(mode); }
+
+	// Values before role conversions, extracted in one pass
+	static void getPlannedRawValues(const unsigned char* data, const PlannedParam* params, size_t count, int* out_values);
+	int convertPlannedValue(EPatchMode mode, const PlannedParam& param, int rawValue, unsigned char* data);
+	void patchPlanned(EPatchMode mode, const PlannedParam& param, int value);
+
+	// Calls func(param, value) for each param, its value extracted in batches and converted
+	template<typename Func>
+	void forEachPlannedValue(EPatchMode mode, const PlannedParams& params, unsigned char* data, Func&& func);
+	void patchPlannedParams(EPatchMode mode, const PlannedParams& params, unsigned char* data);
+
+	void patchInnerProgram(EPatchMode mode, const InnerProgramPlan& plan, unsigned char* data);
+	void patchTimbreProgram(const InnerProgramPlan& plan, unsigned char* data);
+	void patchSharedConversions(EPatchMode mode, const SharedPlan& plan, unsigned char* data);
+	void patchEffect(EPatchMode mode, const EffectPlan& plan, unsigned char* data, int effectId);
+	void patchArpeggiator(EPatchMode mode, const ArpeggiatorPlan& plan);
+	void patchDrumKit(EPatchMode mode, const DrumKitPlan& plan);
 
 	KorgBank* findDependencyBank(KorgPCG* pcg, int depBank);
 
-	ProgParam* findParamByKey(EPatchMode mode, PCG_Converter::ParamList& content, const std::string& key);
-	void patchValue(EPatchMode mode, ParamList& content, const std::string& jsonName, int value);
 
-	void patchCombiUnusedValues(ParamList& content, const std::string& prefix);
-	void patchProgramUnusedValues(EPatchMode mode, ParamList& content, const std::string& prefix);
+	void patchUnusedValues(EPatchMode mode, const UnusedValuesPlan& plan);
 	void postPatchCombi(ParamList& content);
 
 	static std::pair<int, std::string> getCategory(EPatchMode mode, EnumKorgModel model, const ParamList& content);
@@ -140,20 +442,28 @@ private:
 		std::string programName;
 	};
 
+	void patchProgram(unsigned char* data);
+	std::vector<Timber> patchCombi(unsigned char* data);
+
 	static void jsonWriteHeaderBegin(std::ostream& json, const std::string& presetName, EPatchMode mode, EnumKorgModel model, const ParamList& content);
 	static void jsonWriteHeaderEnd(std::ostream& json, int presetId, int bankNumber,
 		const std::string& targetLetter, const std::string& mode);
 	static void jsonWriteEnd(std::ostream& json, const std::string& presetType);
-	static void jsonWriteDSPSettings(std::ostream& json, const ParamList& content);
+	void jsonWriteDSPSettings(std::ostream& json, const ParamList& content);
 	static void jsonWriteTimbers(std::ostream& json, const std::vector<Timber>& timbers);
 
-	void convertProgramJsonToBin(PCG_Converter::ParamList& content, const std::string& programName, std::ostream& outStream);
+	void convertProgramJsonToBin(const PCG_Converter::ParamList& content, const std::string& programName, std::ostream& outStream);
 
 	KorgPCG* m_pcg = nullptr;
 	EnumKorgModel m_targetModel;
 	const std::string m_destFolder;
 
+	std::shared_ptr<const ConverterResources> m_resources;
+	static std::mutex m_sharedResourcesMutex;
+	static std::shared_ptr<const ConverterResources> m_sharedResources; // Null until a converter has built them
+
 	bool m_initialized = false;
+	uint32_t m_workerCount = 1;
 
 	ParamList m_dictProgParams;
 	ParamList m_dictCombiParams;
@@ -161,8 +471,22 @@ private:
 	KorgPCG* m_factoryPcg = nullptr;
 
 	std::function<void(const std::string&)> m_logFunc;
+	std::vector<LogEntry>* m_logBuffer = nullptr; // Set on parallel workers: logs are flushed in preset order
+
+	// Shared by a converter and its parallel workers, which may print from several threads. A converter built
+	// from a core has its own: each PCG reports its fallbacks
+	typedef std::array<std::atomic<bool>, static_cast<size_t>(EWarning::Count)> PrintedWarnings;
+	std::shared_ptr<PrintedWarnings> m_printedWarnings = std::make_shared<PrintedWarnings>();
+
+	// Raw values of the programs played by combi timbres, keyed by program data (so by PCG, bank and program).
+	// Timbres of every combi share them: only their slots differ
+	std::unordered_map<const unsigned char*, std::vector<int>> m_timbreProgramCache;
+
+	std::string m_jsonBuffer; // dsp_settings are formatted here, then written at once
 
-	static std::vector<char> m_gmData;
+	static std::atomic<bool> m_instrumented;
+	PhaseReport m_phaseReport;
+	uint64_t m_paramWrites = 0;
 
 	struct GMInfo
 	{
@@ -173,22 +497,13 @@ private:
 	};
 	static std::vector<GMInfo> m_gmInfo;
 
-	struct GMBankData
-	{
-		GMBankData(uint8_t inBankId, uint8_t inProgramId, int inDataOffset)
-			: bankId(inBankId)
-			, programId(inProgramId)
-			, dataOffset(inDataOffset)
-		{}
+	static constexpr int kGMFirstBankId = 6; // GM, g(1)..g(9), g(d)
+	static constexpr int kGMBankCount = 11;
+	static constexpr int kGMProgramCount = 128;
 
-		uint8_t bankId;
-		uint8_t programId;
-		int dataOffset = 0;
-	};
-	static std::vector<GMBankData> m_mappedGMInfo;
-
-	static std::map<std::string, int> m_mapProgram_keyToId;
-	static std::map<std::string, int> m_mapCombi_keyToId;
+	// Fills out_table (indexed like ConverterResources::gmProgramOffsets) with the value of each m_gmInfo entry's name in valuesByName
+	static void mapGMPrograms(const std::unordered_map<std::string, int>& valuesByName, std::vector<int>& out_table);
+	static bool readGMIndex(const char* gmData, size_t gmDataSize, std::vector<int>& out_programOffsets);
 
 	static std::vector<TritonStruct> shared_conversions;
 
@@ -206,8 +521,17 @@ private:
 	static std::vector<std::string> drumkit_notes;
 	static std::vector<TritonStruct> drumkit_conversions;
 
-	static std::map<int, std::vector<TritonStruct>> effect_conversions;
-	static void initEffectConversions();
+	struct EffectConversions
+	{
+		const EffectConversion* first = nullptr;
+		size_t count = 0;
+
+		const EffectConversion* begin() const { return first; }
+		const EffectConversion* end() const { return first + count; }
+	};
+
+	// Conversions of the specific parameters of an effect type, empty when it has none
+	static EffectConversions getEffectConversions(int effectType);
 
 	static std::vector<TritonStruct> combi_conversions;
 	static std::vector<SubParam> combi_timbres;
@@ -1,5 +1,8 @@
 #include "pcg_converter.h"
 
+#include <array>
+#include <iterator>
+
 std::vector<SubParam> PCG_Converter::program_ifx_offsets = {
 	{ 1, 16 }, { 2, 40 }, { 3, 64 }, { 4, 88 }, { 5, 112 }
 };
@@ -15,1874 +18,1927 @@ std::vector<TritonStruct> PCG_Converter::program_ifx_conversions = {
 	{ "IFX1 Send 2"									, "send_2_level", 23, 0, 7 },
 };
 
-std::map<int, std::vector<TritonStruct>> PCG_Converter::effect_conversions;
+static constexpr EffectConversion effectType(int type)
+{
+	EffectConversion marker;
+	marker.effectType = type;
+	return marker;
+}
+
+// Each effect type is followed by its conversions. Consecutive effect types share the same conversions
+static constexpr EffectConversion kEffectConversions[] = {
+	effectType(1), // St. Amp Simulation
+	{ "Amplifier Type"            , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "3_24", 3 , 0, 7, EVarType::Signed },
+
+	effectType(2), // Stereo Compressor
+	{ "Envelope Select"           , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Sensitivity"               , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Attack"                    , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "EQ Trim"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Output Level"              , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Output Level: Src"         , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Output Level: Amt"         , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(3), // Stereo Limiter
+	{ "Envelope Select"           , "0_24", 0 , 0, 1, EVarType::Unsigned },
+	{ "Ratio"                     , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "2_24", 2 , 0, 7, EVarType::Signed },
+	{ "Attack"                    , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Release"                   , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Gain Adjust [dB]"          , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Gain Adjust: Src"          , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Gain Adjust: Amt"          , "7_24", 7 , 0, 7, EVarType::Signed },
+	{ "Side PEQ insert"           , "8_24", 0 , 2, 2, EVarType::Unsigned },
+	{ "Trigger Moniter"           , "9_24", 0 , 3, 3, EVarType::Unsigned },
+	{ "Side PEQ Cutoff [Hz]"      , "10_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Q"                         , "11_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Gain [dB]"                 , "12_24", 10, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "13_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 13, 0, 7, EVarType::Signed },
+
+	effectType(4), // Multiband Limiter
+	{ "Ratio"                     , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "1_24", 1 , 0, 7, EVarType::Signed },
+	{ "Attack"                    , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Release"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Low Offset [dB]"           , "4_24", 5 , 0, 7, EVarType::Signed },
+	{ "Mid Offset [dB]"           , "5_24", 6 , 0, 7, EVarType::Signed },
+	{ "High Offset [dB]"          , "6_24", 7 , 0, 7, EVarType::Signed },
+	{ "Gain Adjust [dB]"          , "7_24", 4 , 0, 7, EVarType::Signed },
+	{ "Gain Adjust: Src"          , "8_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Gain Adjust: Amt"          , "9_24", 12, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "10_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 9 , 0, 7, EVarType::Signed },
+
+	effectType(5), // Stereo Gate
+	{ "Envelope Select"           , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Select: Src"      , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Polarity"                  , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Threshold"                 , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Attack"                    , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Release"                   , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Delay Time [msec]"         , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 9 , 0, 7, EVarType::Signed },
+
+	effectType(6), // OD/Hi.Gain Wah
+	{ "Wah"                       , "0_24", 11, 0, 0, EVarType::Unsigned },
+	{ "Wah: Src"                  , "1_24", 11, 1, 5, EVarType::Unsigned },
+	{ "Wah.Sw"                    , "2_24", 3 , 0, 0, EVarType::Unsigned },
+	{ "Wah Sweep Range"           , "3_24", 10, 3, 7, EVarType::Signed },
+	{ "Wah Sweep Src"             , "4_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Drive Mode"                , "5_24", 12, 0, 0, EVarType::Unsigned },
+	{ "Drive"                     , "6_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Pre Low-cut"               , "7_24", 3 , 1, 4, EVarType::Unsigned },
+	{ "Output Level"              , "8_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Output Level: Src"         , "9_24", 9 , 0, 4, EVarType::Unsigned },
+	{ "Output Level: Amt"         , "10_24", 14, 0, 7, EVarType::Signed },
+	{ "Low Cutoff[Hz]"            , "11_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "12_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "13_24", 0 , 2, 7, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "14_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Mid1: Gain [dB]"           , "15_24", 6 , 0, 3, EVarType::Signed, 7 , 6, 7 },
+	{ "Mid2 Cutoff[Hz]"           , "16_24", 5 , 0, 1, EVarType::Unsigned, 6 , 4, 7 },
+	{ "Mid2: Q"                   , "17_24", 5 , 2, 7, EVarType::Unsigned },
+	{ "Mid2: Gain [dB]"           , "18_24", 8 , 0, 2, EVarType::Signed, 9 , 5, 7 },
+	{ "Direct Mix"                , "19_24", 12, 1, 6, EVarType::Unsigned },
+	{ "Speaker Simulation"        , "20_24", 4 , 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "21_24", 4 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "22_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(7), // St. Parametric 4EQ
+	{ "Trim"                      , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Band1 Type"                , "1_24", 9 , 0, 0, EVarType::Unsigned },
+	{ "Band4 Type"                , "2_24", 10, 0, 0, EVarType::Unsigned },
+	{ "Band2 Dynamic Gain Src"    , "3_24", 2 , 0, 3, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Band2 Dynamic Gain Amt [dB]", "4_24", 1 , 0, 1, EVarType::Signed, 2 , 4, 7 },
+	{ "Band1 Cutoff [Hz]"         , "5_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "6_24", 0 , 0, 0, EVarType::Unsigned, 1 , 2, 7 },
+	{ "Band1: Gain [dB]"          , "7_24", 0 , 1, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Band2: Q"                  , "9_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "10_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
+	{ "Band3 Cutoff[Hz]"          , "11_24", 4 , 0, 2, EVarType::Unsigned, 5 , 4, 7 },
+	{ "Band3: Q"                  , "12_24", 9 , 1, 7, EVarType::Unsigned },
+	{ "Band3: Gain [dB]"          , "13_24", 10, 1, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "14_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Band4: Q"                  , "15_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Band4: Gain [dB]"          , "16_24", 13, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "17_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "18_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "19_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(8), // St. Graphic 7EQ
+	{ "Type"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Trim"                      , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Band1 [dB]"                , "2_24", 2 , 0, 7, EVarType::Signed },
+	{ "Band2 [dB]"                , "3_24", 3 , 0, 7, EVarType::Signed },
+	{ "Band3 [dB]"                , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "Band4 [dB]"                , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Band5 [dB]"                , "6_24", 6 , 0, 7, EVarType::Signed },
+	{ "Band6 [dB]"                , "7_24", 7 , 0, 7, EVarType::Signed },
+	{ "Band7 [dB]"                , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(9), // St. Wah/Auto Wah
+	{ "Frequency Bottom"          , "0_24", 1 , 0, 6, EVarType::Unsigned },
+	{ "Frequency Top"             , "1_24", 0 , 0, 5, EVarType::Unsigned, 1 , 7, 7 },
+	{ "Sweep Mode"                , "2_24", 0 , 6, 7, EVarType::Unsigned },
+	{ "Sweep Mode: Src"           , "3_24", 3 , 0, 4, EVarType::Unsigned },
+	{ "Response"                  , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Sens"             , "5_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Envelope Shape"            , "6_24", 5 , 0, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "7_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "8_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
+	{ "LFO Frequency [Hz]: Amt"   , "9_24", 7 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "10_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "11_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "12_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Times"                     , "13_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "14_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Resonance"                 , "15_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Low Pass Filter"           , "16_24", 2 , 2, 2, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "17_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "18_24", 2 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "19_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(10), // St. Random Filter
+	{ "LFO Waveform"              , "0_24", 9 , 0, 0, EVarType::Unsigned },
+	{ "LFO Phase [degree]"        , "1_24", 11, 0, 5, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "2_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]: Src"   , "3_24", 12, 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]: Amt"   , "4_24", 2 , 0, 7, EVarType::Signed },
+	{ "LFO Step Freq [Hz]"        , "5_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Step Freq [Hz]: Amt"   , "6_24", 4 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "7_24", 12, 5, 5, EVarType::Unsigned },
+	{ "BPM"                       , "8_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "9_24", 14, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "10_24", 15, 0, 3, EVarType::Unsigned },
+	{ "Step Base Note"            , "11_24", 15, 4, 7, EVarType::Unsigned },
+	{ "Step Base Note: Times"     , "12_24", 14, 3, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "13_24", 12, 6, 6, EVarType::Unsigned },
+	{ "Manual"                    , "14_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "15_24", 9 , 1, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "16_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Depth: Amt"                , "17_24", 5 , 0, 7, EVarType::Signed },
+	{ "Resonance"                 , "18_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "19_24", 7 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "20_24", 10, 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 8 , 0, 7, EVarType::Signed },
+
+	effectType(11), // St. Exciter/Enhncr
+	{ "Exciter Blend"             , "0_24", 0 , 0, 7, EVarType::Signed },
+	{ "Exciter Blend: Src"        , "1_24", 11, 0, 4, EVarType::Unsigned },
+	{ "Exciter Blend: Amt"        , "2_24", 1 , 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "3_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Emphatic Point: Src"       , "4_24", 10, 0, 1, EVarType::Unsigned, 11, 5, 7 },
+	{ "Emphatic Point: Amt"       , "5_24", 3 , 0, 7, EVarType::Signed },
+	{ "Enhancer Dly L [msec]"     , "6_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Enhancer Dly R [msec]"     , "7_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Enhancer Depth"            , "8_24", 9 , 0, 0, EVarType::Unsigned, 10, 2, 7 },
+	{ "Enhancer Depth: Src"       , "9_24", 15, 0, 4, EVarType::Unsigned },
+	{ "Enhancer Depth: Amt"       , "10_24", 6 , 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "11_24", 8 , 0, 6, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "12_24", 14, 0, 3, EVarType::Signed, 15, 5, 7 },
+	{ "Pre HEQ Gain [dB]"         , "13_24", 13, 0, 2, EVarType::Signed, 14, 4, 7 },
+	{ "Wet/Dry"                   , "14_24", 12, 0, 1, EVarType::Unsigned, 13, 3, 7 },
+	{ "Wet/Dry: Src"              , "15_24", 12, 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 7 , 0, 7, EVarType::Signed },
+
+	effectType(12), // St. Sub Oscillator
+	{ "OSC Mode"                  , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Note Interval"             , "1_24", 1 , 0, 7, EVarType::Signed },
+	//{ "(Reserved)"                , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Note Fine"                 , "3_24", 3 , 0, 7, EVarType::Signed },
+	{ "Fixed Frequency [Hz]"      , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Fixed Frequency: Src"      , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Fixed Frequency: Amt"      , "6_24", 6 , 0, 7, EVarType::Signed },
+	{ "Envelope Pre LPF"          , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Sens"             , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Shape"            , "9_24", 9 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(13), // Talking Modulator
+	{ "Sweep Mode"                , "0_24", 0 , 0, 0, EVarType::Unsigned },
+	{ "Manual Voice Control"      , "1_24", 0 , 1, 7, EVarType::Unsigned },
+	{ "Manual Voice Control: Src" , "2_24", 1 , 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Voice Top"                 , "11_24", 1 , 5, 7, EVarType::Unsigned },
+	{ "Voice Center"              , "12_24", 2 , 0, 2, EVarType::Unsigned },
+	{ "Voice Bottom"              , "13_24", 2 , 3, 5, EVarType::Unsigned },
+	{ "Formant Shift"             , "14_24", 6 , 0, 7, EVarType::Signed },
+	{ "Resonance"                 , "15_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "16_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "17_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "18_24", 9 , 0, 7, EVarType::Signed },
+
+	effectType(14), // Stereo Decimator
+	{ "Pre LPF"                   , "0_24", 4 , 0, 0, EVarType::Unsigned },
+	{ "Sampling Freq [Hz]"        , "1_24", 10, 0, 0, EVarType::Unsigned, 11, 0, 7 },
+	{ "Sampling Freq: Src"        , "2_24", 1 , 0, 4, EVarType::Unsigned },
+	{ "Sampling Freq: Amt"        , "3_24", 12, 0, 0, EVarType::Signed, 13, 0, 7 },
+	{ "High Damp [%]"             , "4_24", 4 , 1, 7, EVarType::Unsigned },
+	{ "Resolution"                , "5_24", 0 , 0, 2, EVarType::Unsigned, 1 , 5, 7 },
+	{ "Output Level"              , "6_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Output Level: Src"         , "7_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Output Level: Amt"         , "8_24", 6 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "9_24", 10, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 3 , 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 7 , 0, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "12_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "13_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
+	{ "LFO Frequency: Amt"        , "14_24", 9 , 0, 7, EVarType::Signed },
+	{ "Depth"                     , "15_24", 12, 1, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "16_24", 2 , 2, 6, EVarType::Unsigned },
+	{ "Depth: Amt"                , "17_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(15), // St. Analog Record
+	{ "Speed [RPM]"               , "0_24", 1 , 0, 1, EVarType::Unsigned },
+	{ "Flutter"                   , "1_24", 0 , 0, 0, EVarType::Unsigned, 1 , 2, 7 },
+	{ "Noise Density"             , "2_24", 0 , 1, 7, EVarType::Unsigned },
+	{ "Noise Tone"                , "3_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "Noise Level"               , "4_24", 5 , 0, 6, EVarType::Unsigned },
+	{ "Noise Level: Src"          , "5_24", 3 , 0, 4, EVarType::Unsigned },
+	{ "Noise Level: Amt"          , "6_24", 13, 0, 7, EVarType::Signed },
+	{ "Click Level"               , "7_24", 6 , 0, 6, EVarType::Unsigned },
+	{ "Click Level: Src"          , "8_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
+	{ "Click Level: Amt"          , "9_24", 14, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "10_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Pre EQ Cutoff [Hz]"        , "11_24", 8 , 0, 6, EVarType::Unsigned },
+	{ "Pre EQ Cutoff: Q"          , "12_24", 9 , 0, 6, EVarType::Unsigned },
+	{ "Pre EQ Cutoff: Gain [dB]"  , "13_24", 10, 0, 6, EVarType::Signed },
+	{ "Wet/Dry"                   , "14_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "15_24", 2 , 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(16), // St. Chorus
+	{ "LFO Waveform"              , "0_24", 12, 0, 0, EVarType::Unsigned },
+	{ "LFO Phase [degree]"        , "1_24", 12, 1, 6, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "2_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]: Src"   , "3_24", 11, 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "4_24", 1 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
+	{ "L Pre Delay [msec]"        , "10_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "R Pre Delay [msec]"        , "11_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "12_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "13_24", 10, 0, 1, EVarType::Unsigned, 11, 5, 7 },
+	{ "Depth: Amt"                , "14_24", 5 , 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "15_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "16_24", 10, 2, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "17_24", 6 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "18_24", 7 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "19_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "20_24", 9 , 0, 7, EVarType::Signed },
+
+	effectType(17), // St. Harmonic Chorus
+	{ "LFO Waveform"              , "0_24", 3 , 0, 0, EVarType::Unsigned },
+	{ "LFO Phase [degree]"        , "1_24", 3 , 1, 5, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "2_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]: Src"   , "3_24", 2 , 0, 2, EVarType::Unsigned, 3 , 6, 7 },
+	{ "LFO Frequency: Amt"        , "4_24", 9 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Pre Delay [msec]"          , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "11_24", 1 , 0, 1, EVarType::Unsigned, 2 , 3, 7 },
+	{ "Depth: Src"                , "12_24", 7 , 0, 4, EVarType::Unsigned },
+	{ "Depth: Amt"                , "13_24", 11, 0, 7, EVarType::Signed },
+	{ "High/Low Split Point"      , "14_24", 0 , 0, 0, EVarType::Unsigned, 1 , 2, 7 },
+	{ "Feedback"                  , "15_24", 12, 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "16_24", 0 , 1, 7, EVarType::Unsigned },
+	{ "Low Level"                 , "17_24", 6 , 0, 3, EVarType::Unsigned, 7 , 5, 7 },
+	{ "High Level"                , "18_24", 5 , 0, 2, EVarType::Unsigned, 6 , 4, 7 },
+	{ "Wet/Dry"                   , "19_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "20_24", 5 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 4 , 0, 7, EVarType::Signed },
+
+	effectType(18), // Multitap Cho/Dly
+	{ "LFO Frequency [Hz]"        , "0_24", 12, 0, 2, EVarType::Unsigned, 13, 5, 7 },
+	{ "Tap1 (000) [msec]"         , "1_24", 14, 0, 5, EVarType::Unsigned, 15, 7, 7 },
+	{ "Tap1: Depth"               , "2_24", 10, 0, 1, EVarType::Unsigned, 11, 5, 7 },
+	{ "Tap1: Level"               , "3_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Tap1: Pan"                 , "4_24", 3 , 4, 7, EVarType::Signed },
+	{ "Tap2 (180) [msec]"         , "5_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
+	{ "Tap2: Depth"               , "6_24", 9 , 0, 3, EVarType::Unsigned, 10, 7, 7 },
+	{ "Tap2: Level"               , "7_24", 6 , 0, 1, EVarType::Unsigned, 7 , 5, 7 },
+	{ "Tap2: Pan"                 , "8_24", 4 , 4, 7, EVarType::Signed },
+	{ "Tap3 (090) [msec]"         , "9_24", 13, 0, 4, EVarType::Unsigned, 14, 6, 7 },
+	{ "Tap3: Depth"               , "10_24", 10, 2, 6, EVarType::Unsigned },
+	{ "Tap3: Level"               , "11_24", 7 , 0, 4, EVarType::Unsigned },
+	{ "Tap3: Pan"                 , "12_24", 4 , 0, 3, EVarType::Signed },
+	{ "Tap4 (270) [msec]"         , "13_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Tap4: Depth"               , "14_24", 11, 0, 4, EVarType::Unsigned },
+	{ "Tap4: Level"               , "15_24", 12, 3, 7, EVarType::Unsigned },
+	{ "Tap4: Pan"                 , "16_24", 3 , 0, 3, EVarType::Signed },
+	{ "Tap1 Feedback"             , "17_24", 0 , 0, 7, EVarType::Signed },
+	{ "Tap1 Feedback: Amt"        , "18_24", 1 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "19_24", 5 , 0, 5, EVarType::Unsigned, 6 , 7, 7 },
+	{ "Tap1 Feedback: Src"        , "20_24", 6 , 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 2 , 0, 7, EVarType::Signed },
+
+	effectType(19), // Ensemble
+	{ "Speed"                     , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Speed: Src"                , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Speed: Amt"                , "2_24", 2 , 0, 7, EVarType::Signed },
+	{ "Depth"                     , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Amt"                , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Shimmer"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 9 , 0, 7, EVarType::Signed },
+
+	effectType(20), // Stereo Flanger
+	{ "Delay Time [msec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "LFO Waveform"              , "1_24", 12, 0, 0, EVarType::Unsigned },
+	{ "LFO Shape"                 , "2_24", 1 , 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "3_24", 12, 1, 6, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "4_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "5_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "6_24", 4 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "7_24", 13, 0, 7, EVarType::Unsigned },
+	{ "BPM"                       , "8_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "9_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "10_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "11_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Depth"                     , "12_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "13_24", 6 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "14_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "15_24", 9 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "16_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "17_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(21), // St. Random Flanger
+	{ "Delay Time [msec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "LFO Waveform"              , "1_24", 11, 0, 0, EVarType::Unsigned },
+	{ "LFO Phase [degree]"        , "2_24", 11, 1, 6, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "4_24", 12, 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "5_24", 2 , 0, 7, EVarType::Signed },
+	{ "LFO Step Freq [Hz]"        , "6_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Step Freq: Amt"        , "7_24", 4 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "8_24", 12, 5, 5, EVarType::Unsigned },
+	{ "BPM"                       , "9_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "10_24", 14, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "11_24", 15, 0, 3, EVarType::Unsigned },
+	{ "Step Base Note"            , "12_24", 15, 4, 7, EVarType::Unsigned },
+	{ "Step Base Note: Times"     , "13_24", 14, 3, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "14_24", 12, 6, 6, EVarType::Unsigned },
+	{ "Depth"                     , "15_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "16_24", 6 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "17_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "18_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "19_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "20_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(22), // St. Env. Flanger
+	{ "L Dly Bottom [msec]"       , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "L Dly Top [msec]"          , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "R Dly Bottom [msec]"       , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "R Dly Top [msec]"          , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Sweep Mode"                , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Sweep Mode: Src"           , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "EG Attack"                 , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "EG Delay"                  , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "10_24", 10, 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "11_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(23), // Stereo Phaser
+	{ "LFO Waveform"              , "0_24", 12, 0, 0, EVarType::Unsigned },
+	{ "LFO Shape"                 , "1_24", 0 , 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "2_24", 12, 1, 6, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "4_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Amt"       , "5_24", 3 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Manual"                    , "11_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "12_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "13_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Amt"                , "14_24", 7 , 0, 7, EVarType::Signed },
+	{ "Resonance"                 , "15_24", 8 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "16_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "17_24", 9 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "18_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "19_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(24), // St. Random Phaser
+	{ "LFO Waveform"              , "0_24", 11, 0, 1, EVarType::Unsigned },
+	{ "LFO Phase [degree]"        , "1_24", 11, 2, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "2_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "3_24", 12, 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency : Amt"       , "4_24", 2 , 0, 7, EVarType::Signed },
+	{ "LFO Step Freq [Hz]"        , "5_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Step Freq: Amt"        , "6_24", 4 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "7_24", 12, 5, 5, EVarType::Unsigned },
+	{ "BPM"                       , "8_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "9_24", 14, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "10_24", 15, 0, 3, EVarType::Unsigned },
+	{ "Step Base Note"            , "11_24", 15, 4, 7, EVarType::Unsigned },
+	{ "Step Base Note: Times"     , "12_24", 14, 3, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "13_24", 12, 6, 6, EVarType::Unsigned },
+	{ "Manual"                    , "14_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "15_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Resonance"                 , "16_24", 6 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "17_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "18_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "19_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "20_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(25), // St. Env Phaser
+	{ "L Manu Bottom"             , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "L Manu Top"                , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "R Manu Bottom"             , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "R Manu Top"                , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Sweep Mode"                , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Sweep Mode: Src"           , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "EG Attack"                 , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "EG Delay"                  , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Resonance"                 , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "10_24", 10, 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "11_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(26), // St.Biphase Mod.
+	{ "LFO1 Waveform"             , "0_24", 3 , 7, 7, EVarType::Unsigned },
+	{ "LFO2 Waveform"             , "1_24", 4 , 7, 7, EVarType::Unsigned },
+	{ "LFO Phase Sw"              , "2_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "LFO1 Frequency [Hz]"       , "3_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "LFO1 Frequency: Src"       , "4_24", 14, 2, 6, EVarType::Unsigned },
+	{ "LFO1 Frequency: Amt"       , "5_24", 8 , 0, 7, EVarType::Signed },
+	{ "LFO2 Frequency [Hz]"       , "6_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO2 Frequency: Amt"       , "7_24", 9 , 0, 7, EVarType::Signed },
+	{ "Depth1"                    , "8_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Depth1: Src"               , "9_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
+	{ "Depth1: Amt"               , "10_24", 10, 0, 7, EVarType::Signed },
+	{ "Depth2"                    , "11_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "Depth2: Amt"               , "12_24", 11, 0, 7, EVarType::Signed },
+	{ "L Pre Delay [msec]"        , "13_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "R Pre Delay [msec]"        , "14_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "15_24", 5 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "16_24", 6 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "17_24", 7 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "18_24", 15, 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "19_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(27), // Stereo Vibrato
+	{ "LFO Waveform"              , "0_24", 1 , 0, 0, EVarType::Unsigned },
+	{ "LFO Shape"                 , "1_24", 2 , 0, 7, EVarType::Signed },
+	{ "LFO Frequency Mod"         , "2_24", 12, 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Freqency: Src"         , "4_24", 1 , 1, 5, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "5_24", 4 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Depth"                     , "11_24", 12, 1, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "12_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Depth: Amt"                , "13_24", 5 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "14_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "15_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 6 , 0, 7, EVarType::Signed },
+	{ "AUTOFADE Src"              , "17_24", 10, 0, 4, EVarType::Unsigned },
+	{ "Fade-In Rate"              , "18_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Fade-In Delay [msec]"      , "19_24", 7 , 0, 7, EVarType::Unsigned },
+
+	effectType(28), // St. Auto Fade Mod.
+	{ "LFO Waveform"              , "0_24", 5 , 0, 0, EVarType::Unsigned },
+	{ "LFO Shape"                 , "1_24", 10, 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "2_24", 5 , 1, 4, EVarType::Signed },
+	{ "LFO Frequency Mod"         , "3_24", 5 , 5, 5, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "4_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "5_24", 4 , 0, 2, EVarType::Unsigned, 5 , 6, 7 },
+	{ "LFO Frequency: Amt"        , "6_24", 8 , 0, 7, EVarType::Signed },
+	{ "L Delay Time [msec]"       , "7_24", 2 , 0, 4, EVarType::Unsigned, 3 , 0, 7 },
+	{ "R Delay Time [msec]"       , "8_24", 0 , 0, 1, EVarType::Unsigned, 1 , 0, 7, Byte(2, 5, 7) },
+	{ "Depth"                     , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "10_24", 11, 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "11_24", 6 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry Mod"               , "12_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "13_24", 13, 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "14_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 14, 0, 7, EVarType::Signed },
+	{ "AUTOFADE Src"              , "16_24", 0 , 2, 6, EVarType::Unsigned },
+	{ "Fade-In Rate"              , "17_24", 12, 0, 6, EVarType::Unsigned },
+	{ "Fade-In Dly [msec]"        , "18_24", 15, 0, 7, EVarType::Unsigned },
+
+	effectType(29), // 2Voice Resonator
+	{ "Control Mode"              , "0_24", 12, 4, 5, EVarType::Unsigned },
+	{ "LFO/D-mod Invert"          , "1_24", 1 , 7, 7, EVarType::Unsigned },
+	{ "D-mod Src"                 , "2_24", 8 , 0, 1, EVarType::Unsigned, 9 , 5, 7 },
+	{ "Trim"                      , "3_24", 1 , 0, 6, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Mod. Depth"                , "5_24", 6 , 0, 7, EVarType::Signed },
+	{ "Voice1: Pitch"             , "6_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Voice2: Pitch"             , "7_24", 14, 0, 5, EVarType::Unsigned, 15, 7, 7 },
+	{ "Voice1: Resonance"         , "8_24", 2 , 0, 7, EVarType::Signed },
+	{ "Voice2: Resonance"         , "9_24", 3 , 0, 7, EVarType::Signed },
+	{ "Voice1: High Damp [%]"     , "10_24", 13, 0, 4, EVarType::Unsigned, 14, 6, 7 },
+	{ "Voice2: High Damp [%]"     , "11_24", 12, 0, 3, EVarType::Unsigned, 13, 5, 7 },
+	{ "Voice1: Level"             , "12_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Voice2: Level"             , "13_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
+	{ "Voice1: Pan"               , "14_24", 7 , 0, 3, EVarType::Signed },
+	{ "Voice2: Pan"               , "15_24", 7 , 4, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "16_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
+	{ "Wet/Dry: Src"              , "17_24", 8 , 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "18_24", 5 , 0, 7, EVarType::Signed },
+	{ "Voice1: Fine [cent]"       , "19_24", 0 , 0, 3, EVarType::Signed },
+	{ "Voice2: Fine [cent]"       , "20_24", 0 , 4, 7, EVarType::Signed },
+
+	effectType(30), // Doppler
+	{ "LFO Mode"                  , "0_24", 4 , 0, 0, EVarType::Unsigned },
+	{ "LFO Mode: Src"             , "1_24", 3 , 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "2_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Src"       , "3_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
+	{ "LFO Frequency : Amt"       , "4_24", 6 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Pitch Depth"               , "10_24", 1 , 0, 0, EVarType::Unsigned, 2 , 2, 7 },
+	{ "Pitch Depth: Src"          , "11_24", 1 , 1, 5, EVarType::Unsigned },
+	{ "Pitch Depth: Amt"          , "12_24", 7 , 0, 7, EVarType::Signed },
+	{ "Pan Depth"                 , "13_24", 8 , 0, 7, EVarType::Signed },
+	{ "Pan Depth: Src"            , "14_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Pan Depth: Amt"            , "15_24", 9 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "16_24", 4 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "17_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "18_24", 10, 0, 7, EVarType::Signed },
+	{ "LFO Sync"                  , "19_24", 13, 1, 1, EVarType::Unsigned },
+
+	effectType(31), // Scratch
+	{ "Scratch Source"            , "0_24", 5 , 1, 5, EVarType::Unsigned },
+	{ "Scratch Response"          , "1_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Select"           , "2_24", 2 , 0, 0, EVarType::Unsigned },
+	{ "Envelope Select: Src"      , "3_24", 1 , 1, 5, EVarType::Unsigned },
+	{ "Threshold"                 , "4_24", 2 , 1, 7, EVarType::Unsigned },
+	{ "Response"                  , "5_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Direct Mix"                , "6_24", 1 , 6, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "7_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "8_24", 4 , 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 0 , 0, 7, EVarType::Signed },
+
+	effectType(32), // Stereo Tremolo
+	{ "LFO Waveform"              , "0_24", 9 , 0, 2, EVarType::Unsigned },
+	{ "LFO Shape"                 , "1_24", 0 , 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "2_24", 12, 1, 6, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Src"       , "4_24", 9 , 3, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Amt"       , "5_24", 2 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Depth"                     , "11_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "12_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Amt"                , "13_24", 5 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "14_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "15_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 8 , 0, 7, EVarType::Signed },
+
+	effectType(33), // St. Env. Tremolo
+	{ "Envelope Sens"             , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Shape"            , "1_24", 1 , 0, 7, EVarType::Signed },
+	{ "LFO Waveform"              , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "LFO Shape"                 , "3_24", 3 , 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Amount [Hz]"      , "6_24", 6 , 0, 7, EVarType::Signed },
+	{ "Depth"                     , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Envelope Amount"           , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(34), // Stereo Auto Pan
+	{ "LFO Waveform"              , "0_24", 9 , 0, 0, EVarType::Unsigned },
+	{ "LFO Shape"                 , "1_24", 0 , 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "2_24", 12, 1, 6, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Src"       , "4_24", 9 , 3, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Amt"       , "5_24", 2 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Depth"                     , "11_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Src"                , "12_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Amt"                , "13_24", 5 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "14_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "15_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 8 , 0, 7, EVarType::Signed },
+
+	effectType(35), // St. Phaser + Trml
+	{ "Type"                      , "0_24", 0 , 0, 2, EVarType::Unsigned },
+	{ "LFO Phase [degree]"        , "1_24", 1 , 0, 2, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency : Src"       , "3_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "4_24", 3 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Phaser Manual"             , "10_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Phaser Depth"              , "11_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Phaser Depth: Src"         , "12_24", 1 , 3, 7, EVarType::Unsigned },
+	{ "Phaser Depth: Amt"         , "13_24", 6 , 0, 4, EVarType::Signed, 7 , 6, 7 },
+	{ "Resonance"                 , "14_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
+	{ "Phaser Wet/Dry"            , "15_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
+	{ "Tremolo Shape"             , "16_24", 11, 0, 6, EVarType::Signed },
+	{ "Tremolo Depth"             , "17_24", 10, 0, 4, EVarType::Unsigned, 11, 7, 7 },
+	{ "Tremolo Depth: Src"        , "18_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Tremolo Depth: Amt"        , "19_24", 9 , 0, 3, EVarType::Signed, 10, 5, 7 },
+	{ "Wet/Dry"                   , "20_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
+	{ "Wet/Dry: Src"              , "21_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "22_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(36), // St. Ring Modulator
+	{ "Pre LPF"                   , "0_24", 6 , 0, 6, EVarType::Unsigned },
+	{ "OSC Mode"                  , "1_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "Fixed Frequency [Hz]"      , "2_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Fixed Frequency: Src"      , "3_24", 3 , 0, 4, EVarType::Unsigned },
+	{ "Fixed Frequency: Amt"      , "4_24", 2 , 0, 4, EVarType::Signed, 3 , 5, 7 },
+	{ "Note Offset"               , "5_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
+	{ "(Reserved)"                , "6_24", 0 , 0, 0, EVarType::Unsigned, 1 , 4, 7 },
+	{ "Note Fine"                 , "7_24", 8 , 0, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "8_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "9_24", 5 , 0, 4, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "10_24", 10, 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "11_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "12_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "13_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "14_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "15_24", 15, 7, 7, EVarType::Unsigned },
+	{ "LFO Depth"                 , "16_24", 13, 1, 7, EVarType::Unsigned },
+	{ "LFO Depth: Src"            , "17_24", 4 , 0, 1, EVarType::Unsigned, 5 , 5, 7 },
+	{ "LFO Depth: Amt"            , "18_24", 11, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "19_24", 0 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "20_24", 4 , 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(37), // Detune
+	{ "Pitch Shift [cent]"        , "0_24", 0 , 0, 7, EVarType::Signed },
+	{ "Pitch Shift: Src"          , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Pitch Shift: Amt"          , "2_24", 2 , 0, 7, EVarType::Signed },
+	{ "Delay Time [msec]"         , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Input Level: Src"          , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Input Level Dmod [%]"      , "7_24", 7 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "10_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(38), // Pitch Shifter
+	{ "Mode"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Pitch Shift [1/2tone]"     , "1_24", 1 , 0, 7, EVarType::Signed },
+	{ "Pitch Shift: Src"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Pitch Shift: Amt"          , "3_24", 3 , 0, 7, EVarType::Signed },
+	{ "Fine [cent]"               , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "Fine: Amt"                 , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Delay Time [msec]"         , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Feedback Position"         , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Input Level: Src"          , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Input Level Dmod [%]"      , "11_24", 11, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "12_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "13_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "14_24", 14, 0, 7, EVarType::Signed },
+
+	effectType(39), // Pitch Shift Mod.
+	{ "Pitch Shift [cent]"        , "0_24", 0 , 0, 7, EVarType::Signed },
+	{ "LFO Waveform"              , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Src"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "LFO Frequency: Amt"        , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
+	{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
+	{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
+	//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Depth"                     , "10_24", 5 , 0, 7, EVarType::Signed },
+	{ "Depth: Src"                , "11_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Depth: Amt"                , "12_24", 7 , 0, 7, EVarType::Signed },
+	{ "Pan"                       , "13_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "14_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "15_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(40), // Rotary Speaker
+	{ "Mode Switch"               , "0_24", 0 , 0, 0, EVarType::Unsigned },
+	{ "Mode Switch: Src"          , "1_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Mode Switch: Sw"           , "2_24", 0 , 2, 2, EVarType::Unsigned },
+	{ "Speed Switch"              , "3_24", 0 , 1, 1, EVarType::Unsigned },
+	{ "Speed Switch: Src"         , "4_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Speed Switch: Sw"          , "5_24", 0 , 3, 3, EVarType::Unsigned },
+	{ "Manual Speed Ctrl"         , "6_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Rotor Acceleration"        , "7_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Rotor Ratio"               , "8_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Horn Acceleration"         , "9_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Horn Ratio"                , "10_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Horn/Rotor Balance"        , "11_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Mic Distance"              , "12_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Mic Spread"                , "13_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "14_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "15_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 13, 0, 7, EVarType::Signed },
+
+	effectType(41), // Early Reflections
+	{ "Type"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "ER Time [msec]"            , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "EQ Trim"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "8_24", 8 , 0, 7, EVarType::Signed },
+
+	effectType(42), // Auto Reverse
+	{ "Rec Mode"                  , "0_24", 1 , 0, 0, EVarType::Unsigned },
+	{ "Envelope Select"           , "1_24", 2 , 0, 0, EVarType::Unsigned },
+	{ "Envelope: Src"             , "2_24", 1 , 1, 5, EVarType::Unsigned },
+	{ "Threshold"                 , "3_24", 2 , 1, 7, EVarType::Unsigned },
+	{ "Direct Mix"                , "4_24", 1 , 6, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "5_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "6_24", 4 , 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "7_24", 0 , 0, 7, EVarType::Signed },
+	{ "Reverse Time [msec]"       , "8_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Response"                  , "9_24", 6 , 0, 7, EVarType::Unsigned },
+
+	effectType(43), // L/C/R Delay
+	{ "L Delay Time [msec]"       , "0_24", 2 , 0, 3, EVarType::Unsigned, 3 , 0, 7 },
+	{ "L Delay Level"             , "1_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "C Delay Time [msec]"       , "2_24", 1 , 0, 7, EVarType::Unsigned, 2 , 4, 7 },
+	{ "C Delay Level"             , "3_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
+	{ "R Delay Time [msec]"       , "4_24", 5 , 0, 7, EVarType::Unsigned, 6 , 4, 7 },
+	{ "R Delay Level"             , "5_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Feedback (C Delay)"        , "6_24", 0 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "7_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Feedback: Amt"             , "8_24", 4 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "9_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
+	{ "Low Damp [%]"              , "10_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Input Level: Src"          , "11_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
+	{ "Input Level Dmod [%]"      , "12_24", 8 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "13_24", 9 , 2, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "14_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
+	{ "Wet/Dry: Src"              , "15_24", 13, 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(44), // Stereo/Cross Delay
+	{ "L Delay Time [msec]"       , "0_24", 14, 0, 5, EVarType::Unsigned, 15, 0, 7 },
+	{ "R Delay Time [msec]"       , "1_24", 12, 0, 3, EVarType::Unsigned, 13, 0, 7, Byte(14, 6, 7 )},
+	{ "Wet/Dry"                   , "2_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "3_24", 8 , 0, 1, EVarType::Unsigned, 9 , 5, 7 },
+	{ "Wet/Dry: Amt"              , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "L Feedback"                , "5_24", 0 , 0, 7, EVarType::Signed },
+	{ "R Feedback"                , "6_24", 1 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "7_24", 8 , 2, 6, EVarType::Unsigned },
+	{ "L Feedback: Amt"           , "8_24", 2 , 0, 7, EVarType::Signed },
+	{ "R Feedback: Amt"           , "9_24", 3 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "10_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
+	{ "Low Damp [%]"              , "11_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Input Level Src"           , "12_24", 6 , 0, 3, EVarType::Unsigned, 7 , 7, 7 },
+	{ "Input Level Dmod [%]"      , "13_24", 5 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "14_24", 10, 0, 5, EVarType::Signed, 11, 7, 7 },
+	{ "Stereo/Cross"              , "15_24", 8 , 7, 7, EVarType::Unsigned },
+
+	effectType(45), // St. Multitap Delay
+	{ "Tap1 Time [msec]"          , "0_24", 10, 0, 4, EVarType::Unsigned, 11, 0, 7 },
+	{ "Tap2 Time [msec]"          , "1_24", 14, 0, 4, EVarType::Unsigned, 15, 0, 7 },
+	{ "Wet/Dry"                   , "2_24", 9 , 0, 3, EVarType::Unsigned, 10, 5, 7 },
+	{ "Wet/Dry: Src"              , "3_24", 7 , 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "Feedback (Tap2)"           , "5_24", 0 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "6_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Feedback: Amt"             , "7_24", 1 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "8_24", 13, 0, 3, EVarType::Unsigned, 14, 5, 7 },
+	{ "Low Damp [%]"              , "9_24", 12, 0, 2, EVarType::Unsigned, 13, 4, 7 },
+	{ "Input Level Src"           , "10_24", 6 , 0, 1, EVarType::Unsigned, 7 , 5, 7 },
+	{ "Input Level Dmod [%]"      , "11_24", 5 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "12_24", 2 , 0, 7, EVarType::Signed },
+	{ "Spread: Src"               , "13_24", 12, 3, 7, EVarType::Unsigned },
+	{ "Spread: Amt"               , "14_24", 3 , 0, 7, EVarType::Signed },
+	{ "Mode"                      , "15_24", 6 , 2, 3, EVarType::Unsigned },
+	{ "Tap1 Level"                , "16_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
+
+	effectType(46), // St. Modulation Delay
+	{ "Modulation Mode"           , "0_24", 7 , 6, 6, EVarType::Unsigned },
+	{ "D-mod Modulation: Src"     , "1_24", 9 , 2, 6, EVarType::Unsigned },
+	{ "Response"                  , "2_24", 11, 0, 6, EVarType::Unsigned },
+	{ "LFO Waveform"              , "3_24", 7 , 7, 7, EVarType::Unsigned },
+	{ "LFO Shape"                 , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "LFO Sync"                  , "6_24", 9 , 7, 7, EVarType::Unsigned },
+	{ "LFO Sync: Src"             , "7_24", 9 , 0, 1, EVarType::Unsigned, 10, 5, 7 },
+	{ "L LFO Phase [degree]"      , "8_24", 7 , 0, 5, EVarType::Signed },
+	{ "R LFO Phase [degree]"      , "9_24", 12, 2, 7, EVarType::Signed },
+	{ "L Depth"                   , "10_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "R Depth"                   , "11_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "L Delay Time [msec]"       , "12_24", 14, 0, 4, EVarType::Unsigned, 15, 0, 7 },
+	{ "R Delay Time [msec]"       , "13_24", 12, 0, 1, EVarType::Unsigned, 13, 0, 7, Byte(14, 5, 7) },
+	{ "L Feedback"                , "14_24", 0 , 0, 7, EVarType::Signed },
+	{ "R Feedback"                , "15_24", 1 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "16_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry: Src"              , "17_24", 10, 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "18_24", 6 , 0, 7, EVarType::Signed },
+	{ "D-mod Modulation"          , "19_24", 11, 7, 7, EVarType::Unsigned },
+
+	effectType(47), // St. Dynamic Delay
+	{ "Control Target"            , "0_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Polarity"                  , "1_24", 11, 0, 0, EVarType::Unsigned },
+	{ "Threshold"                 , "2_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Attack"                    , "3_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Release"                   , "4_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "L Delay Time [msec]"       , "5_24", 12, 0, 7, EVarType::Unsigned, 13, 0, 7 },
+	{ "R Delay Time [msec]"       , "6_24", 14, 0, 7, EVarType::Unsigned, 15, 0, 7 },
+	{ "Wet/Dry"                   , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 9 , 0, 7, EVarType::Signed },
+	{ "Feedback"                  , "10_24", 3 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "11_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Low Damp [%]"              , "12_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Spread"                    , "13_24", 6 , 0, 7, EVarType::Signed },
+	{ "Offset"                    , "14_24", 11, 1, 7, EVarType::Unsigned },
+
+	effectType(48), // St. Auto Panning Dly
+	{ "L Delay Time [msec]"       , "0_24", 2 , 0, 4, EVarType::Unsigned, 3 , 0, 7 },
+	{ "R Delay Time [msec]"       , "1_24", 0 , 0, 1, EVarType::Unsigned, 1 , 0, 7, Byte(2, 5, 7) },
+	{ "L Feedback"                , "2_24", 6 , 0, 7, EVarType::Signed },
+	{ "R Feedback"                , "3_24", 7 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "4_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Low Damp [%]"              , "5_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "LFO Waveform"              , "6_24", 5 , 0, 0, EVarType::Unsigned },
+	{ "LFO Shape"                 , "7_24", 10, 0, 7, EVarType::Signed },
+	{ "LFO Phase [degree]"        , "8_24", 0 , 2, 7, EVarType::Signed },
+	{ "Panning Frequency [Hz]"    , "9_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Panning Depth"             , "10_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Panning Depth: Src"        , "11_24", 5 , 1, 5, EVarType::Unsigned },
+	{ "Panning Depth: Amt"        , "12_24", 12, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "13_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 4 , 0, 2, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(49), // L/C/R BPM Delay
+	{ "BPM"                       , "0_24", 5 , 0, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "1_24", 1 , 2, 2, EVarType::Unsigned },
+	{ "L Delay Base Note"         , "2_24", 3 , 0, 2, EVarType::Unsigned },
+	{ "L Delay Base Note: Times"  , "3_24", 6 , 4, 7, EVarType::Unsigned },
+	{ "L Delay Level"             , "4_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "C Delay Base Note"         , "5_24", 3 , 3, 5, EVarType::Unsigned },
+	{ "C Delay Base Note: Times"  , "6_24", 2 , 1, 4, EVarType::Unsigned },
+	{ "C Delay Level"             , "7_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
+	{ "R Delay Base Note"         , "8_24", 2 , 0, 0, EVarType::Unsigned, 3 , 6, 7 },
+	{ "R Delay Base Note: Times"  , "9_24", 1 , 0, 0, EVarType::Unsigned, 2 , 5, 7 },
+	{ "R Delay Level"             , "10_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Time Over? >"              , "11_24", 1 , 1, 1, EVarType::Signed },
+	{ "Feedback (C Delay)"        , "12_24", 0 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "13_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Feedback: Amt"             , "14_24", 4 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "15_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
+	{ "Low Damp [%]"              , "16_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Input Level Src"           , "17_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
+	{ "Input Level Dmod [%]"      , "18_24", 8 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "19_24", 9 , 2, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "20_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
+	{ "Wet/Dry: Src"              , "21_24", 13, 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "22_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(50), // St. BPM Delay
+	{ "BPM"                       , "0_24", 4 , 0, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "1_24", 9 , 7, 7, EVarType::Unsigned },
+	{ "L Delay Base Note"         , "2_24", 5 , 0, 2, EVarType::Unsigned },
+	{ "L Delay Base Note: Times"  , "3_24", 5 , 3, 6, EVarType::Unsigned },
+	{ "L Delay: Adjust [%]"       , "4_24", 10, 0, 7, EVarType::Signed, 11, 7, 7 },
+	{ "Time Over? L >"            , "5_24", 5 , 7, 7, EVarType::Signed },
+	{ "R Delay Base Note"         , "6_24", 6 , 0, 2, EVarType::Unsigned },
+	{ "R Delay Base Note: Times"  , "7_24", 6 , 3, 6, EVarType::Unsigned },
+	{ "R Delay: Adjust [%]"       , "8_24", 12, 0, 7, EVarType::Signed, 13, 7, 7 },
+	{ "Time Over? R >"            , "9_24", 6 , 7, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "10_24", 9 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 14, 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 8 , 0, 7, EVarType::Signed },
+	{ "L Feedback"                , "13_24", 0 , 0, 7, EVarType::Signed },
+	{ "R Feedback"                , "14_24", 1 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "15_24", 15, 0, 4, EVarType::Unsigned },
+	{ "L Feedback: Amt"           , "16_24", 2 , 0, 7, EVarType::Signed },
+	{ "R Feedback: Amt"           , "17_24", 3 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "18_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Low Damp [%]"              , "19_24", 13, 0, 6, EVarType::Unsigned },
+	{ "Input Level Src"           , "20_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
+	{ "Input Level Dmod [%]"      , "21_24", 7 , 0, 7, EVarType::Signed },
+
+	effectType(51), // Sequence Delay
+	{ "BPM"                       , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "1_24", 6 , 0, 0, EVarType::Unsigned },
+	{ "Rhythm Pattern"            , "2_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Feedback"                  , "3_24", 2 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "4_24", 15, 0, 4, EVarType::Unsigned },
+	{ "Feedback: Amt"             , "5_24", 3 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "6_24", 6 , 1, 7, EVarType::Unsigned },
+	{ "Low Damp [%]"              , "7_24", 7 , 1, 7, EVarType::Unsigned },
+	{ "Input Level Src"           , "8_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
+	{ "Input Level Dmod [%]"      , "9_24", 4 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "10_24", 13, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 14, 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 5 , 0, 7, EVarType::Signed },
+	{ "Tap1 Pan"                  , "13_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Tap2 Pan"                  , "14_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
+	{ "Tap3 Pan"                  , "15_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
+	{ "Tap4 Pan"                  , "16_24", 8 , 0, 3, EVarType::Unsigned, 9 , 5, 7 },
+
+	effectType(52), // Reverb Hall
+	effectType(53), // Reverb SmoothHall
+	effectType(54), // Reverb Wet Plate
+	effectType(55), // Reverb Dry Plate
+	{ "Reverb Time [sec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "High Damp [%]"             , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Pre Delay Thru [%]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "EQ Trim"                   , "4_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "5_24", 7 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "6_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "7_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "8_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(56), // Reverb Room
+	effectType(57), // Reverb BrightRoom
+	{ "Reverb Time [sec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "High Damp [%]"             , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Pre Delay Thru [%]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "ER Level"                  , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Reverb Level"              , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "EQ Trim"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "7_24", 7 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "8_24", 8 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(58), // P4EQ - Exciter
+	{ "Trim"                      , "0_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
+	{ "Exciter Blend"             , "13_24", 14, 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "14_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "15_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "16_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "17_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(59), // P4EQ - Wah
+	{ "Trim"                      , "0_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
+	{ "Frequency Bottom"          , "13_24", 9 , 0, 5, EVarType::Unsigned },
+	{ "Frequency Top"             , "14_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Sweep Mode"                , "15_24", 11, 6, 7, EVarType::Unsigned },
+	{ "Sweep Mode: Src"           , "16_24", 8 , 0, 2, EVarType::Unsigned, 9 , 6, 7 },
+	{ "LFO Frequency [Hz]"        , "17_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Resonance"                 , "18_24", 14, 0, 6, EVarType::Unsigned },
+	{ "LPF"                       , "19_24", 14, 7, 7, EVarType::Unsigned },
+	{ "Routing"                   , "20_24", 13, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "21_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "22_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(60), // P4EQ  - Cho/Flng
+	{ "Trim"                      , "0_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
+	{ "Delay Time [msec]"         , "13_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
+	{ "LFO Waveform"              , "14_24", 12, 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "15_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "16_24", 9 , 0, 3, EVarType::Unsigned, 10, 6, 7 },
+	{ "Feedback"                  , "17_24", 8 , 0, 2, EVarType::Signed, 9 , 4, 7 },
+	{ "Cho/Flg Wet/Dry"           , "18_24", 12, 1, 7, EVarType::Signed },
+	{ "Output Mode"               , "19_24", 13, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "20_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "21_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "22_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(61), // P4EQ - Phaser
+	{ "Trim"                      , "0_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
+	{ "LFO Waveform"              , "13_24", 12, 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "14_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Manual"                    , "15_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
+	{ "Depth"                     , "16_24", 9 , 0, 3, EVarType::Unsigned, 10, 6, 7 },
+	{ "Resonance"                 , "17_24", 8 , 0, 2, EVarType::Signed, 9 , 4, 7 },
+	{ "Phaser Wet/Dry"            , "18_24", 12, 1, 7, EVarType::Signed },
+	{ "Output Mode"               , "19_24", 13, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "20_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "21_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "22_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(62), // P4EQ - Mt. Delay
+	{ "Trim"                      , "0_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
+	{ "Tap1 Delay Time [msec]"    , "13_24", 10, 0, 4, EVarType::Unsigned, 11, 6, 7 },
+	{ "Tap2 Delay Time [msec]"    , "14_24", 9 , 0, 3, EVarType::Unsigned, 10, 5, 7 },
+	{ "Tap1 Level"                , "15_24", 8 , 0, 0, EVarType::Unsigned, 9 , 4, 7 },
+	{ "Feedback (Tap2)"           , "16_24", 8 , 1, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "17_24", 15, 0, 5, EVarType::Unsigned },
+	{ "Mt.Delay Wet/Dry"          , "18_24", 14, 0, 3, EVarType::Unsigned, 15, 6, 7 },
+	{ "Wet/Dry"                   , "19_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
+	{ "Wet/Dry: Src"              , "20_24", 13, 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(63), // Comp - Wah
+	{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "CMP: Output Level"         , "2_24", 5 , 0, 6, EVarType::Unsigned },
+	{ "Frequency Bottom"          , "3_24", 4 , 0, 5, EVarType::Unsigned, 5 , 7, 7 },
+	{ "Frequency Top"             , "4_24", 14, 0, 6, EVarType::Unsigned },
+	{ "Sweep Mode"                , "5_24", 4 , 6, 7, EVarType::Unsigned },
+	{ "Sweep Mode: Src"           , "6_24", 1 , 0, 2, EVarType::Unsigned, 2 , 6, 7 },
+	{ "LFO Frequency [Hz]"        , "7_24", 0 , 0, 2, EVarType::Unsigned, 1 , 3, 7 },
+	{ "Resonance"                 , "8_24", 12, 0, 6, EVarType::Unsigned },
+	{ "Low Pass Filter"           , "9_24", 14, 7, 7, EVarType::Unsigned },
+	{ "Routing"                   , "10_24", 13, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "11_24", 13, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "12_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "14_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "15_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "16_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(64), // Comp - Amp Sim
+	{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "CMP: Output Level"         , "2_24", 1 , 0, 6, EVarType::Unsigned },
+	{ "Amplifier Type"            , "3_24", 2 , 6, 7, EVarType::Unsigned },
+	{ "Routing"                   , "4_24", 1 , 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "5_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "6_24", 6 , 0, 3, EVarType::Unsigned, 7 , 7, 7 },
+	{ "Wet/Dry: Amt"              , "7_24", 0 , 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "8_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "9_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "10_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(65), // Comp - OD/HiGain
+	{ "Sensitivity"               , "0_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 13, 0, 6, EVarType::Unsigned },
+	{ "CMP: Output Level"         , "2_24", 14, 0, 6, EVarType::Unsigned },
+	{ "Drive Mode"                , "3_24", 13, 7, 7, EVarType::Unsigned },
+	{ "Drive"                     , "4_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "OD: Output Level"          , "5_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Low Cutoff[Hz]"            , "6_24", 1 , 0, 2, EVarType::Unsigned, 2 , 5, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "7_24", 0 , 0, 0, EVarType::Signed, 1 , 3, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "8_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "9_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Mid1: Gain [dB]"           , "10_24", 4 , 2, 7, EVarType::Signed },
+	{ "Mid2 Cutoff[Hz]"           , "11_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Mid2: Q"                   , "12_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Mid2: Gain [dB]"           , "13_24", 6 , 2, 7, EVarType::Signed },
+	{ "Routing"                   , "14_24", 14, 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "15_24", 0 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "16_24", 12, 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "17_24", 15, 0, 7, EVarType::Signed },
+	{ "OD: Output Level: Src"     , "18_24", 9 , 0, 4, EVarType::Unsigned },
+	{ "OD: Output Level: Amt"     , "19_24", 8 , 0, 3, EVarType::Signed, 9 , 5, 7 },
+
+	effectType(66), // Comp - Param4EQ
+	{ "Sensitivity"               , "0_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 13, 0, 6, EVarType::Unsigned },
+	{ "CMP: Output Level"         , "2_24", 14, 0, 6, EVarType::Unsigned },
+	{ "Trim"                      , "3_24", 12, 0, 6, EVarType::Unsigned },
+	{ "Band1 Cutoff [Hz]"         , "4_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "5_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "6_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "7_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "8_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "9_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "10_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "11_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "12_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "13_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "14_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "15_24", 6 , 2, 7, EVarType::Signed },
+	{ "Routing"                   , "16_24", 14, 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "17_24", 10, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "18_24", 9 , 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "19_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(67), // Comp - Cho/Flng
+	{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "CMP: Output Level"         , "2_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Delay Time [msec]"         , "3_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "LFO Waveform"              , "4_24", 4 , 7, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "5_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "6_24", 0 , 0, 2, EVarType::Unsigned, 1 , 5, 7 },
+	{ "Feedback"                  , "7_24", 5 , 0, 6, EVarType::Signed },
+	{ "Cho/Flng Wet/Dry"          , "8_24", 6 , 0, 6, EVarType::Signed },
+	{ "Output Mode"               , "9_24", 5 , 7, 7, EVarType::Unsigned },
+	{ "Routing"                   , "10_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "11_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "12_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
+	{ "Trim"                      , "14_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "15_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "16_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(68), // Comp - Phaser
+	{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "CMP: Output Level"         , "2_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "LFO Waveform"              , "3_24", 4 , 7, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "4_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Manual"                    , "5_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "Depth"                     , "6_24", 0 , 0, 2, EVarType::Unsigned, 1 , 5, 7 },
+	{ "Resonance"                 , "7_24", 5 , 0, 6, EVarType::Signed },
+	{ "Phaser Wet/Dry"            , "8_24", 6 , 0, 6, EVarType::Signed },
+	{ "Output Mode"               , "9_24", 5 , 7, 7, EVarType::Unsigned },
+	{ "Routing"                   , "10_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "11_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "12_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
+	{ "Trim"                      , "14_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "15_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "16_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(69), // Comp - Mt.Delay
+	{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "CMP: Output Level"         , "2_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Tap1 Time [msec]"          , "3_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Tap2 Time [msec]"          , "4_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Tap1 Level"                , "5_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "Feedback (Tap2)"           , "6_24", 14, 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "7_24", 5 , 0, 6, EVarType::Unsigned },
+	{ "Mt.Delay Wet/Dry"          , "8_24", 6 , 0, 6, EVarType::Unsigned },
+	{ "Routing"                   , "9_24", 1 , 5, 5, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "10_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Wet/Dry: Amt"              , "12_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "13_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "14_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "15_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(70), // Limiter - P4EQ
+	{ "Ratio"                     , "0_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "1_24", 15, 0, 6, EVarType::Signed },
+	{ "Attack"                    , "2_24", 10, 0, 4, EVarType::Unsigned, 11, 6, 7 },
+	{ "Release"                   , "3_24", 9 , 0, 3, EVarType::Unsigned, 10, 5, 7 },
+	{ "Gain Adjust [dB]"          , "4_24", 11, 0, 5, EVarType::Signed },
+	{ "Trim"                      , "5_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
+	{ "Band1 Cutoff [Hz]"         , "6_24", 1 , 0, 5, EVarType::Unsigned },
+	{ "Band1: Q"                  , "7_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Band1: Gain [dB]"          , "8_24", 0 , 2, 7, EVarType::Signed },
+	{ "Band2 Cutoff [Hz]"         , "9_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Band2: Q"                  , "10_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
+	{ "Band2: Gain [dB]"          , "11_24", 2 , 2, 7, EVarType::Signed },
+	{ "Band3 Cutoff[Hz]"          , "12_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Band3: Q"                  , "13_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Band3: Gain [dB]"          , "14_24", 4 , 2, 7, EVarType::Signed },
+	{ "Band4 Cutoff [Hz]"         , "15_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Band4: Q"                  , "16_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Band4: Gain [dB]"          , "17_24", 6 , 2, 7, EVarType::Signed },
+	{ "Routing"                   , "18_24", 12, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "19_24", 12, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "20_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 14, 0, 7, EVarType::Signed },
+
+	effectType(71), // Limiter - Cho/Flng
+	{ "Ratio"                     , "0_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "1_24", 3 , 0, 6, EVarType::Signed },
+	{ "Attack"                    , "2_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Release"                   , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Gain Adjust [dB]"          , "4_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
+	{ "Delay Time [msec]"         , "5_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "LFO Waveform"              , "6_24", 4 , 7, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "7_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "8_24", 12, 0, 5, EVarType::Unsigned },
+	{ "Feedback"                  , "9_24", 5 , 0, 6, EVarType::Signed },
+	{ "Cho/Flng Wet/Dry"          , "10_24", 6 , 0, 6, EVarType::Signed },
+	{ "Output Mode"               , "11_24", 5 , 7, 7, EVarType::Unsigned },
+	{ "Routing"                   , "12_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "13_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "16_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "17_24", 10, 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "18_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(72), // Limiter - Phaser
+	{ "Ratio"                     , "0_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "1_24", 3 , 0, 6, EVarType::Signed },
+	{ "Attack"                    , "2_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Release"                   , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Gain Adjust [dB]"          , "4_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
+	{ "LFO Waveform"              , "5_24", 4 , 7, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "6_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Manual"                    , "7_24", 4 , 0, 6, EVarType::Unsigned },
+	{ "Depth"                     , "8_24", 12, 0, 5, EVarType::Unsigned },
+	{ "Resonance"                 , "9_24", 5 , 0, 6, EVarType::Signed },
+	{ "Phaser Wet/Dry"            , "10_24", 6 , 0, 6, EVarType::Signed },
+	{ "Output Mode"               , "11_24", 5 , 7, 7, EVarType::Unsigned },
+	{ "Routing"                   , "12_24", 6 , 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "13_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(73), // Limiter - Mt. Delay
+	{ "Ratio"                     , "0_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "1_24", 3 , 0, 6, EVarType::Signed },
+	{ "Attack"                    , "2_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Release"                   , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Gain Adjust [dB]"          , "4_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
+	{ "Tap1 Time [msec]"          , "5_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Tap2 Time [msec]"          , "6_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Tap1 Level"                , "7_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Feedback (Tap2)"           , "8_24", 14, 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "9_24", 8 , 0, 6, EVarType::Unsigned },
+	{ "Mt.Delay Wet/Dry"          , "10_24", 9 , 0, 6, EVarType::Unsigned },
+	{ "Routing"                   , "11_24", 10, 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "12_24", 10, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "13_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "14_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(74), // Exciter - Comp
+	{ "Exciter Blend"             , "0_24", 0 , 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Sensitivity"               , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Attack"                    , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Output Level"              , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Routing"                   , "5_24", 14, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "6_24", 14, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "7_24", 13, 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "8_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "9_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "10_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "11_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(75), // Exciter - Limiter
+	{ "Exciter Blend"             , "0_24", 4 , 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "1_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Ratio"                     , "2_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "3_24", 3 , 0, 6, EVarType::Signed },
+	{ "Attack"                    , "4_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Release"                   , "5_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Gain Adjust [dB]"          , "6_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
+	{ "Routing"                   , "7_24", 8 , 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "8_24", 8 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "9_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "10_24", 7 , 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "11_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "12_24", 9 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "13_24", 10, 0, 7, EVarType::Signed },
+
+	effectType(76), // Exciter - Cho/Flng
+	{ "Exciter Blend"             , "0_24", 4 , 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "1_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Delay Time [msec]"         , "2_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "LFO Waveform"              , "3_24", 6 , 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "4_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "5_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Feedback"                  , "6_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
+	{ "Cho/Flng Wet/Dry"          , "7_24", 0 , 0, 2, EVarType::Signed, 1 , 4, 7 },
+	{ "Output Mode"               , "8_24", 9 , 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "9_24", 6 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 8 , 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "12_24", 9 , 1, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "13_24", 10, 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "14_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(77), // Exciter - Phaser
+	{ "Exciter Blend"             , "0_24", 4 , 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "1_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "LFO Waveform"              , "2_24", 6 , 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "3_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Manual"                    , "4_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Depth"                     , "5_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Resonance"                 , "6_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
+	{ "Phaser Wet/Dry"            , "7_24", 0 , 0, 2, EVarType::Signed, 1 , 4, 7 },
+	{ "Output Mode"               , "8_24", 9 , 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "9_24", 6 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 8 , 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "12_24", 9 , 1, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "13_24", 10, 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "14_24", 11, 0, 7, EVarType::Signed },
+
+	effectType(78), // Exciter - Mt.Delay
+	{ "Exciter Blend"             , "0_24", 10, 0, 7, EVarType::Signed },
+	{ "Emphatic Point"            , "1_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Tap1 Time [msec]"          , "2_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Tap2 Time [msec]"          , "3_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Tap1 Level"                , "4_24", 0 , 0, 6, EVarType::Unsigned },
+	{ "Feedback (Tap2)"           , "5_24", 14, 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "6_24", 1 , 0, 6, EVarType::Unsigned },
+	{ "Mt.Delay Wet/Dry"          , "7_24", 2 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "8_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "9_24", 5 , 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "10_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "11_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "12_24", 4 , 0, 1, EVarType::Signed, 5 , 5, 7 },
+	{ "Pre HEQ Gain [dB]"         , "13_24", 4 , 2, 6, EVarType::Signed },
+
+	effectType(79), // OD/HG - Amp Sim
+	{ "Drive Mode"                , "0_24", 13, 0, 0, EVarType::Unsigned },
+	{ "Drive"                     , "1_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "OD: Output Level"          , "2_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 2, EVarType::Unsigned, 2 , 5, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 0, EVarType::Signed, 1 , 3, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "5_24", 5 , 0, 5, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "6_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Mid1: Gain [dB]"           , "7_24", 4 , 2, 7, EVarType::Signed },
+	{ "Mid2 Cutoff[Hz]"           , "8_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Mid2: Q"                   , "9_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Mid2: Gain [dB]"           , "10_24", 6 , 2, 7, EVarType::Signed },
+	{ "Amplifier Type"            , "11_24", 14, 6, 7, EVarType::Unsigned },
+	{ "Routing"                   , "12_24", 14, 5, 5, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "13_24", 0 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 14, 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
+	{ "OD: Output Level: Src"     , "16_24", 12, 0, 4, EVarType::Unsigned },
+	{ "OD: Output Level: Amt"     , "17_24", 13, 1, 7, EVarType::Signed },
+
+	effectType(80), // OD/HG - Cho/Flng
+	{ "Drive Mode"                , "0_24", 3 , 0, 0, EVarType::Unsigned },
+	{ "Drive"                     , "1_24", 3 , 1, 7, EVarType::Unsigned },
+	{ "OD: Output Level"          , "2_24", 2 , 0, 5, EVarType::Unsigned },
+	{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "5_24", 0 , 2, 7, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "6_24", 9 , 0, 3, EVarType::Unsigned },
+	{ "Mid1: Gain [dB]"           , "7_24", 8 , 0, 1, EVarType::Signed, 9 , 4, 7 },
+	{ "Mid2 Cutoff[Hz]"           , "8_24", 8 , 2, 7, EVarType::Unsigned },
+	{ "Mid2: Q"                   , "9_24", 13, 0, 3, EVarType::Unsigned },
+	{ "Mid2: Gain [dB]"           , "10_24", 7 , 0, 5, EVarType::Signed },
+	{ "Delay Time [msec]"         , "11_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
+	{ "LFO Waveform"              , "12_24", 10, 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "13_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "14_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Feedback"                  , "15_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
+	{ "Cho/Flng Wet/Dry"          , "16_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
+	{ "Output Mode"               , "17_24", 11, 6, 6, EVarType::Unsigned },
+	{ "Routing"                   , "18_24", 11, 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "19_24", 10, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "20_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 15, 0, 7, EVarType::Signed },
+	{ "OD: Output Level: Src"     , "22_24", 12, 0, 0, EVarType::Unsigned, 13, 4, 7 },
+	{ "OD: Output Level: Amt"     , "23_24", 12, 1, 7, EVarType::Signed },
+
+	effectType(81), // OD/HG - Phaser
+	{ "Drive Mode"                , "0_24", 3 , 0, 0, EVarType::Unsigned },
+	{ "Drive"                     , "1_24", 3 , 1, 7, EVarType::Unsigned },
+	{ "OD: Output Level"          , "2_24", 2 , 0, 5, EVarType::Unsigned },
+	{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "5_24", 0 , 2, 7, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "6_24", 9 , 0, 3, EVarType::Unsigned },
+	{ "Mid1: Gain [dB]"           , "7_24", 8 , 0, 1, EVarType::Signed, 9 , 4, 7 },
+	{ "Mid2 Cutoff[Hz]"           , "8_24", 8 , 2, 7, EVarType::Unsigned },
+	{ "Mid2: Q"                   , "9_24", 13, 0, 3, EVarType::Unsigned },
+	{ "Mid2: Gain [dB]"           , "10_24", 7 , 0, 5, EVarType::Signed },
+	{ "LFO Waveform"              , "11_24", 10, 0, 0, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "12_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Manual"                    , "13_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Depth"                     , "14_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Resonance"                 , "15_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
+	{ "Phaser Wet/Dry"            , "16_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
+	{ "Output Mode"               , "17_24", 11, 6, 6, EVarType::Unsigned },
+	{ "Routing"                   , "18_24", 11, 7, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "19_24", 10, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "20_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "21_24", 15, 0, 7, EVarType::Signed },
+	{ "OD: Output Level: Src"     , "22_24", 12, 0, 0, EVarType::Unsigned, 13, 4, 7 },
+	{ "OD: Output Level: Amt"     , "23_24", 12, 1, 7, EVarType::Signed },
+
+	effectType(82), // OD/HG - Mt. Delay
+	{ "Drive Mode"                , "0_24", 3 , 0, 0, EVarType::Unsigned },
+	{ "Drive"                     , "1_24", 3 , 1, 7, EVarType::Unsigned },
+	{ "OD: Output Level"          , "2_24", 2 , 0, 5, EVarType::Unsigned },
+	{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "5_24", 0 , 2, 7, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "6_24", 9 , 0, 3, EVarType::Unsigned },
+	{ "Mid1: Gain [dB]"           , "7_24", 8 , 0, 1, EVarType::Signed, 9 , 4, 7 },
+	{ "Mid2 Cutoff[Hz]"           , "8_24", 8 , 2, 7, EVarType::Unsigned },
+	{ "Mid2: Q"                   , "9_24", 15, 0, 3, EVarType::Unsigned },
+	{ "Mid2: Gain [dB]"           , "10_24", 7 , 0, 5, EVarType::Signed },
+	{ "Tap1 Delay Time [msec]"    , "11_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
+	{ "Tap2 Delay Time [msec]"    , "12_24", 5 , 0, 3, EVarType::Unsigned, 6 , 5, 7 },
+	{ "Tap1 Level"                , "13_24", 4 , 0, 0, EVarType::Unsigned, 5 , 4, 7 },
+	{ "Feedback (Tap2)"           , "14_24", 4 , 1, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "15_24", 14, 0, 1, EVarType::Unsigned, 15, 4, 7 },
+	{ "Mt.Delay Wet/Dry"          , "16_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "17_24", 13, 0, 0, EVarType::Unsigned, 14, 2, 7 },
+	{ "Wet/Dry: Src"              , "18_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Wet/Dry: Amt"              , "19_24", 12, 0, 0, EVarType::Signed, 13, 1, 7 },
+	{ "OD: Output Level: Src"     , "20_24", 10, 3, 7, EVarType::Unsigned },
+	{ "OD: Output Level: Amt"     , "21_24", 12, 1, 7, EVarType::Signed },
+
+	effectType(83), // Wah - Amp Sim
+	{ "Frequency Bottom"          , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Frequency Top"             , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Sweep Mode"                , "2_24", 12, 0, 1, EVarType::Unsigned },
+	{ "Sweep Mode: Src"           , "3_24", 1 , 0, 2, EVarType::Unsigned, 2 , 6, 7 },
+	{ "LFO Frequency [Hz]"        , "4_24", 0 , 0, 2, EVarType::Unsigned, 1 , 3, 7 },
+	{ "Resonance"                 , "5_24", 13, 0, 6, EVarType::Unsigned },
+	{ "Low Pass Filter"           , "6_24", 13, 7, 7, EVarType::Unsigned },
+	{ "Amplifier Type"            , "7_24", 12, 2, 3, EVarType::Unsigned },
+	{ "Routing"                   , "8_24", 14, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "9_24", 14, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(84), // Decimator - Amp
+	{ "Pre LPF"                   , "0_24", 5 , 0, 0, EVarType::Unsigned },
+	{ "Sampling Freq [Hz]"        , "1_24", 4 , 0, 1, EVarType::Unsigned, 5 , 1, 7 },
+	{ "High Damp [%]"             , "2_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Resolution"                , "3_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "DECI: Output Level"        , "4_24", 1 , 0, 3, EVarType::Unsigned, 2 , 5, 7 },
+	{ "Amplifier Type"            , "5_24", 4 , 2, 3, EVarType::Unsigned },
+	{ "Routing"                   , "6_24", 4 , 4, 4, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "7_24", 0 , 0, 2, EVarType::Unsigned, 1 , 4, 7 },
+	{ "Wet/Dry: Src"              , "8_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(85), // Decimator - Comp
+	{ "Pre LPF"                   , "0_24", 6 , 0, 0, EVarType::Unsigned },
+	{ "Sampling Freq [Hz]"        , "1_24", 4 , 0, 0, EVarType::Unsigned, 5 , 0, 7 },
+	{ "High Damp [%]"             , "2_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Resolution"                , "3_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "DECI: Output Level"        , "4_24", 1 , 0, 3, EVarType::Unsigned, 2 , 5, 7 },
+	{ "Sensitivity"               , "5_24", 0 , 0, 2, EVarType::Unsigned, 1 , 4, 7 },
+	{ "Attack"                    , "6_24", 4 , 1, 7, EVarType::Unsigned },
+	{ "CMP: Output Level"         , "7_24", 6 , 1, 7, EVarType::Unsigned },
+	{ "Routing"                   , "8_24", 7 , 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "9_24", 7 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "11_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(86), // Amp Sim - Tremolo
+	{ "Amplifier Type"            , "0_24", 3 , 0, 1, EVarType::Unsigned },
+	{ "LFO Waveform"              , "1_24", 3 , 2, 4, EVarType::Unsigned },
+	{ "LFO Shape"                 , "2_24", 14, 0, 7, EVarType::Signed },
+	{ "LFO Frequency [Hz]"        , "3_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "4_24", 2 , 0, 3, EVarType::Unsigned, 3 , 5, 7 },
+	{ "Wet/Dry"                   , "5_24", 1 , 0, 2, EVarType::Unsigned, 2 , 4, 7 },
+	{ "Wet/Dry: Src"              , "6_24", 1 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "7_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(87), // Cho/Flng - Mt.Dly
+	{ "Delay Time [msec]"         , "0_24", 10, 0, 6, EVarType::Unsigned },
+	{ "LFO Waveform"              , "1_24", 10, 7, 7, EVarType::Unsigned },
+	{ "LFO Frequency [Hz]"        , "2_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Depth"                     , "3_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Feedback"                  , "4_24", 2 , 0, 4, EVarType::Signed, 3 , 6, 7 },
+	{ "Cho/Flng Wet/Dry"          , "5_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
+	{ "Tap1 Time [msec]"          , "6_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Tap2 Time [msec]"          , "7_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Tap1 Level"                , "8_24", 0 , 0, 2, EVarType::Unsigned, 1 , 4, 7 },
+	{ "Feedback (Tap2)"           , "9_24", 14, 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "10_24", 8 , 0, 6, EVarType::Unsigned },
+	{ "Mt.Delay Wet/Dry"          , "11_24", 9 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "12_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "13_24", 0 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "14_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "15_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "16_24", 5 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "17_24", 6 , 0, 7, EVarType::Signed },
+
+	effectType(88), // Phaser - Cho/Flng
+	{ "Phaser: LFO Waveform"      , "0_24", 12, 0, 0, EVarType::Unsigned },
+	{ "Phaser: LFO Frequency [Hz]", "1_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Manual"                    , "2_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Phaser: Depth"             , "3_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Resonance"                 , "4_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
+	{ "Phaser Wet/Dry"            , "5_24", 0 , 0, 2, EVarType::Signed, 1 , 4, 7 },
+	{ "Delay Time [msec]"         , "6_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Flng: LFO Waveform"        , "7_24", 11, 0, 0, EVarType::Unsigned },
+	{ "Flng: LFO Frequency [Hz]"  , "8_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Flng: Depth"               , "9_24", 6 , 0, 4, EVarType::Unsigned, 7 , 7, 7 },
+	{ "Feedback"                  , "10_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
+	{ "Cho/Flng Wet/Dry"          , "11_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
+	{ "Output Mode"               , "12_24", 10, 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "13_24", 12, 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "16_24", 11, 1, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "17_24", 0 , 3, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "18_24", 10, 1, 5, EVarType::Signed },
+
+	effectType(89), // Reverb - Gate
+	{ "Reverb Time [sec]"         , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "High Damp [%]"             , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Pre Delay [msec]"          , "2_24", 14, 0, 7, EVarType::Unsigned },
+	{ "Reverb Balance"            , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Envelope Select"           , "4_24", 1 , 5, 5, EVarType::Unsigned },
+	{ "Envelope Select: Src"      , "5_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
+	{ "Input Reverb Mix"          , "6_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Polarity"                  , "7_24", 7 , 0, 0, EVarType::Unsigned },
+	{ "Threshold"                 , "8_24", 7 , 1, 7, EVarType::Unsigned },
+	{ "Attack"                    , "9_24", 6 , 0, 6, EVarType::Unsigned },
+	{ "Release"                   , "10_24", 5 , 0, 5, EVarType::Unsigned, 6 , 7, 7 },
+	{ "Wet/Dry"                   , "11_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
+	{ "Wet/Dry: Src"              , "12_24", 4 , 0, 2, EVarType::Unsigned, 5 , 6, 7 },
+	{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
+	{ "EQ Trim"                   , "14_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
+	{ "Pre LEQ Gain [dB]"         , "15_24", 4 , 3, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "16_24", 0 , 3, 7, EVarType::Signed },
+
+	effectType(90), // Piano Body/Damper
+	{ "Sound Board Depth"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Damper Depth"              , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Damper Depth: Src"         , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Tone"                      , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Mid Shape"                 , "4_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "5_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "7_24", 7 , 0, 7, EVarType::Signed },
+	{ "Tune"                      , "8_24", 8 , 0, 7, EVarType::Signed },
+
+	effectType(91), // St. Mltband Limiter
+	{ "Ratio"                     , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Threshold [dB]"            , "1_24", 1 , 0, 7, EVarType::Signed },
+	{ "Attack"                    , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Release"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Low Offset [dB]"           , "4_24", 5 , 0, 7, EVarType::Signed },
+	{ "Mid Offset [dB]"           , "5_24", 6 , 0, 7, EVarType::Signed },
+	{ "High Offset [dB]"          , "6_24", 7 , 0, 7, EVarType::Signed },
+	{ "Gain Adjust [dB]"          , "7_24", 4 , 0, 7, EVarType::Signed },
+	{ "Gain Adjust: Src"          , "8_24", 11, 0, 7, EVarType::Unsigned },
+	{ "Gain Adjust: Amt"          , "9_24", 12, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "10_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 10, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 9 , 0, 7, EVarType::Signed },
+
+	effectType(92), // OD/HyperGain Wah
+	{ "Wah"                       , "0_24", 11, 0, 0, EVarType::Unsigned },
+	{ "Wah: Src"                  , "1_24", 11, 1, 5, EVarType::Unsigned },
+	{ "Wah.Sw"                    , "2_24", 3 , 0, 0, EVarType::Unsigned },
+	{ "Wah Sweep Range"           , "3_24", 10, 3, 7, EVarType::Signed },
+	{ "Wah Sweep Src"             , "4_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Drive Mode"                , "5_24", 12, 0, 0, EVarType::Unsigned },
+	{ "Drive"                     , "6_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Pre Low-cut"               , "7_24", 3 , 1, 4, EVarType::Unsigned },
+	{ "Output Level"              , "8_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Output Level: Src"         , "9_24", 9 , 0, 4, EVarType::Unsigned },
+	{ "Output Level: Amt"         , "10_24", 14, 0, 7, EVarType::Signed },
+	{ "Low Cutoff[Hz]"            , "11_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Low Cutoff: Gain [dB]"     , "12_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
+	{ "Mid1 Cutoff[Hz]"           , "13_24", 0 , 2, 7, EVarType::Unsigned },
+	{ "Mid1: Q"                   , "14_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "Mid1: Gain [dB]"           , "15_24", 6 , 0, 3, EVarType::Signed, 7 , 6, 7 },
+	{ "Mid2 Cutoff[Hz]"           , "16_24", 5 , 0, 1, EVarType::Unsigned, 6 , 4, 7 },
+	{ "Mid2: Q"                   , "17_24", 5 , 2, 7, EVarType::Unsigned },
+	{ "Mid2: Gain [dB]"           , "18_24", 8 , 0, 2, EVarType::Signed, 9 , 5, 7 },
+	{ "Direct Mix"                , "19_24", 12, 1, 6, EVarType::Unsigned },
+	{ "Speaker Simulation"        , "20_24", 4 , 0, 0, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "21_24", 4 , 1, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "22_24", 8 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(93), // Vocoder
+	{ "L (Carrier)   Trim"        , "0_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "R (Modulator) Trim"        , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
+	{ "Formant Shift"             , "2_24", 10, 0, 2, EVarType::Signed },
+	{ "Response"                  , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
+	{ "Noise Level"               , "4_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Noise Level: Src"          , "5_24", 0 , 0, 1, EVarType::Unsigned, 1 , 5, 7 },
+	{ "Noise Level: Amt"          , "6_24", 13, 0, 7, EVarType::Signed },
+	{ "Low Gain [dB]"             , "7_24", 0 , 2, 7, EVarType::Signed },
+	{ "High Gain [dB]"            , "8_24", 6 , 0, 4, EVarType::Signed, 7 , 7, 7 },
+	{ "Modulator High Mix"        , "9_24", 5 , 0, 3, EVarType::Unsigned, 6 , 5, 7 },
+	{ "Vocoder/Carrier"           , "10_24", 4 , 0, 2, EVarType::Unsigned, 5 , 4, 7 },
+	{ "Vocoder/Carrier: Src"      , "11_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Vocoder/Carrier: Amt"      , "12_24", 14, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "13_24", 12, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "14_24", 11, 0, 4, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(94), // Multitap Cho/Delay
+	{ "LFO Frequency [Hz]"        , "0_24", 3 , 0, 5, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "1_24", 4 , 0, 2, EVarType::Unsigned, 5 , 4, 7 },
+	{ "Tap1 Feedback: Src"        , "2_24", 4 , 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "3_24", 2 , 0, 7, EVarType::Signed },
+	{ "Tap6 (300) [msec]"         , "4_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Tap1 (000) [msec]"         , "5_24", 14, 0, 5, EVarType::Unsigned, 15, 7, 7 },
+	{ "Tap3 (060) [msec]"         , "6_24", 13, 0, 4, EVarType::Unsigned, 14, 6, 7 },
+	{ "Tap5 (120) [msec]"         , "7_24", 12, 0, 3, EVarType::Unsigned, 13, 5, 7 },
+	{ "Tap2 (180) [msec]"         , "8_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Tap4 (240) [msec]"         , "9_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
+	{ "Tap6: Depth"               , "10_24", 9 , 0, 2, EVarType::Unsigned, 10, 6, 7 },
+	{ "Tap1: Depth"               , "11_24", 9 , 3, 7, EVarType::Unsigned },
+	{ "Tap3: Depth"               , "12_24", 7 , 0, 4, EVarType::Unsigned },
+	{ "Tap5: Depth"               , "13_24", 6 , 0, 1, EVarType::Unsigned, 7 , 5, 7 },
+	{ "Tap2: Depth"               , "14_24", 6 , 2, 6, EVarType::Unsigned },
+	{ "Tap4: Depth"               , "15_24", 5 , 0, 3, EVarType::Unsigned, 6 , 7, 7 },
+	{ "Tap6: Status"              , "16_24", 12, 4, 5, EVarType::Unsigned },
+	{ "Tap1: Status"              , "17_24", 12, 6, 7, EVarType::Unsigned },
+	{ "Tap3: Status"              , "18_24", 8 , 0, 1, EVarType::Unsigned },
+	{ "Tap5: Status"              , "19_24", 8 , 2, 3, EVarType::Unsigned },
+	{ "Tap2: Status"              , "20_24", 8 , 4, 5, EVarType::Unsigned },
+	{ "Tap4: Status"              , "21_24", 8 , 6, 7, EVarType::Unsigned },
+	{ "Tap1 Feedback"             , "22_24", 0 , 0, 7, EVarType::Signed },
+	{ "Tap1 Feedback: Amt"        , "23_24", 1 , 0, 7, EVarType::Signed },
+	{ "Panning Preset"            , "24_24", 3 , 6, 7, EVarType::Unsigned },
+
+	effectType(95), // St. Pitch Shifter
+	{ "Input Level: Src"          , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Input Level Dmod [%]"      , "1_24", 1 , 0, 7, EVarType::Signed },
+	{ "Mode"                      , "2_24", 15, 5, 6, EVarType::Unsigned },
+	{ "L/R Pitch"                 , "3_24", 15, 7, 7, EVarType::Unsigned },
+	{ "Pitch Shift [1/2tone]"     , "4_24", 2 , 0, 7, EVarType::Signed },
+	{ "Pitch Shift: Src"          , "5_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Pitch Shift: Amt"          , "6_24", 4 , 0, 7, EVarType::Signed },
+	{ "Fine [cent]"               , "7_24", 5 , 0, 7, EVarType::Signed },
+	{ "Fine: Amt"                 , "8_24", 6 , 0, 7, EVarType::Signed },
+	{ "Lch Delay [msec]"          , "9_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Rch Delay [msec]"          , "10_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Feedback Position"         , "11_24", 10, 0, 0, EVarType::Unsigned },
+	{ "Feedback"                  , "12_24", 9 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "13_24", 10, 1, 7, EVarType::Unsigned },
+	{ "Spread"                    , "14_24", 11, 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "15_24", 12, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "16_24", 13, 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "17_24", 14, 0, 7, EVarType::Signed },
+
+	effectType(96), // Rotary Speaker OD
+	{ "Overdrive"                 , "0_24", 12, 7, 7, EVarType::Unsigned },
+	{ "Overdrive: Src"            , "1_24", 11, 0, 4, EVarType::Unsigned },
+	{ "Overdrive: Sw"             , "2_24", 3 , 7, 7, EVarType::Unsigned },
+	{ "Overdrive Gain"            , "3_24", 1 , 0, 6, EVarType::Unsigned },
+	{ "Overdrive Level"           , "4_24", 0 , 0, 5, EVarType::Unsigned, 1 , 7, 7 },
+	{ "Overdrive Tone"            , "5_24", 10, 4, 7, EVarType::Unsigned },
+	{ "Speaker Simulator"         , "6_24", 2 , 0, 0, EVarType::Unsigned },
+	{ "Mode Switch"               , "7_24", 2 , 1, 1, EVarType::Unsigned },
+	{ "Mode Switch: Src"          , "8_24", 13, 0, 4, EVarType::Unsigned },
+	{ "Mode Switch: Sw"           , "9_24", 5 , 7, 7, EVarType::Unsigned },
+	{ "Speed Switch"              , "10_24", 2 , 2, 2, EVarType::Unsigned },
+	{ "Speed Switch: Src"         , "11_24", 12, 0, 1, EVarType::Unsigned, 13, 5, 7 },
+	{ "Speed Switch: Sw"          , "12_24", 7 , 7, 7, EVarType::Unsigned },
+	{ "Manual Speed Ctrl"         , "13_24", 2 , 3, 7, EVarType::Unsigned },
+	{ "Rotor Acceleration"        , "14_24", 3 , 0, 6, EVarType::Unsigned },
+	{ "Rotor Ratio"               , "15_24", 4 , 0, 7, EVarType::Unsigned },
+	{ "Horn Acceleration"         , "16_24", 5 , 0, 6, EVarType::Unsigned },
+	{ "Horn Ratio"                , "17_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Horn/Rotor Balance"        , "18_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Mic Distance"              , "19_24", 8 , 0, 7, EVarType::Unsigned },
+	{ "Mic Spread"                , "20_24", 9 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "21_24", 10, 0, 3, EVarType::Unsigned, 11, 5, 7 },
+	{ "Wet/Dry: Src"              , "22_24", 12, 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed },
+
+	effectType(97), // Early Reflections
+	{ "Type"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "ER Time [msec]"            , "1_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "EQ Trim"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Pre LEQ Gain [dB]"         , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "Pre HEQ Gain [dB]"         , "5_24", 5 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "7_24", 7 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "8_24", 8 , 0, 7, EVarType::Signed },
+
+	effectType(98), // L/C/R Long Delay
+	{ "L Delay Time [msec]"       , "0_24", 2 , 0, 3, EVarType::Unsigned, 3 , 0, 7 },
+	{ "L Delay Level"             , "1_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "C Delay Time [msec]"       , "2_24", 1 , 0, 7, EVarType::Unsigned, 2 , 4, 7 },
+	{ "C Delay Level"             , "3_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
+	{ "R Delay Time [msec]"       , "4_24", 5 , 0, 7, EVarType::Unsigned, 6 , 4, 7 },
+	{ "R Delay Level"             , "5_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Feedback (C Delay)"        , "6_24", 0 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "7_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Feedback: Amt"             , "8_24", 4 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "9_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
+	{ "Low Damp [%]"              , "10_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Input Level: Src"          , "11_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
+	{ "Input Level Dmod [%]"      , "12_24", 8 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "13_24", 9 , 2, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "14_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
+	{ "Wet/Dry: Src"              , "15_24", 13, 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "16_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(99), // St/Cross Long Dly
+	{ "L Delay Time [msec]"       , "0_24", 14, 0, 5, EVarType::Unsigned, 15, 0, 7 },
+	{ "R Delay Time [msec]"       , "1_24", 12, 0, 3, EVarType::Unsigned, 13, 0, 7, Byte(14, 6, 7) },
+	{ "Wet/Dry"                   , "2_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "3_24", 8 , 0, 1, EVarType::Unsigned, 9 , 5, 7 },
+	{ "Wet/Dry: Amt"              , "4_24", 4 , 0, 7, EVarType::Signed },
+	{ "L Feedback"                , "5_24", 0 , 0, 7, EVarType::Signed },
+	{ "R Feedback"                , "6_24", 1 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "7_24", 8 , 2, 6, EVarType::Unsigned },
+	{ "L Feedback: Amt"           , "8_24", 2 , 0, 7, EVarType::Signed },
+	{ "R Feedback: Amt"           , "9_24", 3 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "10_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
+	{ "Low Damp [%]"              , "11_24", 7 , 0, 6, EVarType::Unsigned },
+	{ "Input Level Src"           , "12_24", 6 , 0, 3, EVarType::Unsigned, 7 , 7, 7 },
+	{ "Input Level Dmod [%]"      , "13_24", 5 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "14_24", 10, 0, 5, EVarType::Signed, 11, 7, 7 },
+	{ "Stereo/Cross"              , "15_24", 8 , 7, 7, EVarType::Unsigned },
+
+	effectType(100), // LCR BPM Long Dly
+	{ "BPM"                       , "0_24", 5 , 0, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "1_24", 1 , 2, 2, EVarType::Unsigned },
+	{ "L Delay Base Note"         , "2_24", 3 , 0, 2, EVarType::Unsigned },
+	{ "L Delay Base Note: Times"  , "3_24", 6 , 4, 7, EVarType::Unsigned },
+	{ "L Delay Level"             , "4_24", 7 , 0, 5, EVarType::Unsigned },
+	{ "C Delay Base Note"         , "5_24", 3 , 3, 5, EVarType::Unsigned },
+	{ "C Delay Base Note: Times"  , "6_24", 2 , 1, 4, EVarType::Unsigned },
+	{ "C Delay Level"             , "7_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
+	{ "R Delay Base Note"         , "8_24", 2 , 0, 0, EVarType::Unsigned, 3 , 6, 7 },
+	{ "R Delay Base Note: Times"  , "9_24", 1 , 0, 0, EVarType::Unsigned, 2 , 5, 7 },
+	{ "R Delay Level"             , "10_24", 11, 0, 5, EVarType::Unsigned },
+	{ "Time Over? >"              , "11_24", 1 , 1, 1, EVarType::Signed },
+	{ "Feedback (C Delay)"        , "12_24", 0 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "13_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
+	{ "Feedback: Amt"             , "14_24", 4 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "15_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
+	{ "Low Damp [%]"              , "16_24", 15, 0, 6, EVarType::Unsigned },
+	{ "Input Level Src"           , "17_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
+	{ "Input Level Dmod [%]"      , "18_24", 8 , 0, 7, EVarType::Signed },
+	{ "Spread"                    , "19_24", 9 , 2, 7, EVarType::Unsigned },
+	{ "Wet/Dry"                   , "20_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
+	{ "Wet/Dry: Src"              , "21_24", 13, 3, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "22_24", 12, 0, 7, EVarType::Signed },
+
+	effectType(101), // St. BPM Long Delay
+	{ "BPM"                       , "0_24", 4 , 0, 7, EVarType::Unsigned },
+	//{ "(Reserved)"                , "1_24", 9 , 7, 7, EVarType::Unsigned },
+	{ "L Delay Base Note"         , "2_24", 5 , 0, 2, EVarType::Unsigned },
+	{ "L Delay Base Note: Times"  , "3_24", 5 , 3, 6, EVarType::Unsigned },
+	{ "L Delay: Adjust [%]"       , "4_24", 10, 0, 7, EVarType::Signed, 11, 7, 7 },
+	{ "Time Over? L >"            , "5_24", 5 , 7, 7, EVarType::Signed },
+	{ "R Delay Base Note"         , "6_24", 6 , 0, 2, EVarType::Unsigned },
+	{ "R Delay Base Note: Times"  , "7_24", 6 , 3, 6, EVarType::Unsigned },
+	{ "R Delay: Adjust [%]"       , "8_24", 12, 0, 7, EVarType::Signed, 13, 7, 7 },
+	{ "Time Over? R >"            , "9_24", 6 , 7, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "10_24", 9 , 0, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "11_24", 14, 2, 6, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "12_24", 8 , 0, 7, EVarType::Signed },
+	{ "L Feedback"                , "13_24", 0 , 0, 7, EVarType::Signed },
+	{ "R Feedback"                , "14_24", 1 , 0, 7, EVarType::Signed },
+	{ "Feedback: Src"             , "15_24", 15, 0, 4, EVarType::Unsigned },
+	{ "L Feedback: Amt"           , "16_24", 2 , 0, 7, EVarType::Signed },
+	{ "R Feedback: Amt"           , "17_24", 3 , 0, 7, EVarType::Signed },
+	{ "High Damp [%]"             , "18_24", 11, 0, 6, EVarType::Unsigned },
+	{ "Low Damp [%]"              , "19_24", 13, 0, 6, EVarType::Unsigned },
+	{ "Input Level Src"           , "20_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
+	{ "Input Level Dmod [%]"      , "21_24", 7 , 0, 7, EVarType::Signed },
+
+	effectType(102), // Hold Delay
+	{ "REC Control Src"           , "0_24", 0 , 0, 7, EVarType::Unsigned },
+	{ "Manual REC Control"        , "1_24", 8 , 4, 4, EVarType::Unsigned },
+	{ "RST Control Src"           , "2_24", 1 , 0, 7, EVarType::Unsigned },
+	{ "Manual RST Control"        , "3_24", 8 , 5, 5, EVarType::Unsigned },
+	{ "Pan"                       , "4_24", 2 , 0, 7, EVarType::Unsigned },
+	{ "Pan: Src"                  , "5_24", 3 , 0, 7, EVarType::Unsigned },
+	{ "Pan: Amt"                  , "6_24", 4 , 0, 7, EVarType::Signed },
+	{ "Wet/Dry"                   , "7_24", 5 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Src"              , "8_24", 6 , 0, 7, EVarType::Unsigned },
+	{ "Wet/Dry: Amt"              , "9_24", 7 , 0, 7, EVarType::Signed },
+	{ "Loop Time [msec]"          , "10_24", 8 , 0, 3, EVarType::Unsigned, 9 , 0, 7 }
+};
+
+struct EffectConversionRange
+{
+	uint16_t first = 0;
+	uint16_t count = 0;
+};
+
+// Range of each effect type in kEffectConversions, empty for unknown types
+static constexpr auto indexEffectConversions()
+{
+	std::array<EffectConversionRange, PCG_Converter::kEffectTypeCount> ranges{};
+
+	std::array<int, 8> types{}; // Markers sharing the next conversions
+	size_t typeCount = 0;
+	size_t first = 0;
+
+	const size_t count = std::size(kEffectConversions);
+	for (size_t i = 0; i <= count; i++)
+	{
+		const bool isMarker = (i < count) && kEffectConversions[i].effectType != 0;
+		if (i == count || (isMarker && first < i))
+		{
+			for (size_t j = 0; j < typeCount; j++)
+				ranges[types[j]] = { static_cast<uint16_t>(first), static_cast<uint16_t>(i - first) };
+			typeCount = 0;
+		}
+
+		if (isMarker)
+		{
+			types[typeCount++] = kEffectConversions[i].effectType;
+			first = i + 1;
+		}
+	}
+
+	return ranges;
+}
 
-void PCG_Converter::initEffectConversions()
+static constexpr auto kEffectConversionRanges = indexEffectConversions();
+
+static_assert(kEffectConversionRanges[1].count == 4, "St. Amp Simulation");
+static_assert(kEffectConversionRanges[52].first == kEffectConversionRanges[55].first, "Reverb Hall shares Reverb Dry Plate conversions");
+static_assert(kEffectConversionRanges[102].count == 11, "Hold Delay");
+
+PCG_Converter::EffectConversions PCG_Converter::getEffectConversions(int effectType)
 {
-	if (!effect_conversions.empty())
-		return;
-
-	effect_conversions[1] = { // St. Amp Simulation
-		{ "Amplifier Type"            , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "3_24", 3 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[2] = { // Stereo Compressor
-		{ "Envelope Select"           , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Sensitivity"               , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Attack"                    , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "EQ Trim"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Output Level"              , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Output Level: Src"         , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Output Level: Amt"         , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[3] = { // Stereo Limiter
-		{ "Envelope Select"           , "0_24", 0 , 0, 1, EVarType::Unsigned },
-		{ "Ratio"                     , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "2_24", 2 , 0, 7, EVarType::Signed },
-		{ "Attack"                    , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Release"                   , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Gain Adjust [dB]"          , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Gain Adjust: Src"          , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Gain Adjust: Amt"          , "7_24", 7 , 0, 7, EVarType::Signed },
-		{ "Side PEQ insert"           , "8_24", 0 , 2, 2, EVarType::Unsigned },
-		{ "Trigger Moniter"           , "9_24", 0 , 3, 3, EVarType::Unsigned },
-		{ "Side PEQ Cutoff [Hz]"      , "10_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Q"                         , "11_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Gain [dB]"                 , "12_24", 10, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "13_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 13, 0, 7, EVarType::Signed } };
-
-	effect_conversions[4] = { // Multiband Limiter
-		{ "Ratio"                     , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "1_24", 1 , 0, 7, EVarType::Signed },
-		{ "Attack"                    , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Release"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Low Offset [dB]"           , "4_24", 5 , 0, 7, EVarType::Signed },
-		{ "Mid Offset [dB]"           , "5_24", 6 , 0, 7, EVarType::Signed },
-		{ "High Offset [dB]"          , "6_24", 7 , 0, 7, EVarType::Signed },
-		{ "Gain Adjust [dB]"          , "7_24", 4 , 0, 7, EVarType::Signed },
-		{ "Gain Adjust: Src"          , "8_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Gain Adjust: Amt"          , "9_24", 12, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "10_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 9 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[5] = { // Stereo Gate
-		{ "Envelope Select"           , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Select: Src"      , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Polarity"                  , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Threshold"                 , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Attack"                    , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Release"                   , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Delay Time [msec]"         , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 9 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[6] = { // OD/Hi.Gain Wah
-		{ "Wah"                       , "0_24", 11, 0, 0, EVarType::Unsigned },
-		{ "Wah: Src"                  , "1_24", 11, 1, 5, EVarType::Unsigned },
-		{ "Wah.Sw"                    , "2_24", 3 , 0, 0, EVarType::Unsigned },
-		{ "Wah Sweep Range"           , "3_24", 10, 3, 7, EVarType::Signed },
-		{ "Wah Sweep Src"             , "4_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Drive Mode"                , "5_24", 12, 0, 0, EVarType::Unsigned },
-		{ "Drive"                     , "6_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Pre Low-cut"               , "7_24", 3 , 1, 4, EVarType::Unsigned },
-		{ "Output Level"              , "8_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Output Level: Src"         , "9_24", 9 , 0, 4, EVarType::Unsigned },
-		{ "Output Level: Amt"         , "10_24", 14, 0, 7, EVarType::Signed },
-		{ "Low Cutoff[Hz]"            , "11_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "12_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "13_24", 0 , 2, 7, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "14_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Mid1: Gain [dB]"           , "15_24", 6 , 0, 3, EVarType::Signed, 7 , 6, 7 },
-		{ "Mid2 Cutoff[Hz]"           , "16_24", 5 , 0, 1, EVarType::Unsigned, 6 , 4, 7 },
-		{ "Mid2: Q"                   , "17_24", 5 , 2, 7, EVarType::Unsigned },
-		{ "Mid2: Gain [dB]"           , "18_24", 8 , 0, 2, EVarType::Signed, 9 , 5, 7 },
-		{ "Direct Mix"                , "19_24", 12, 1, 6, EVarType::Unsigned },
-		{ "Speaker Simulation"        , "20_24", 4 , 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "21_24", 4 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "22_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[7] = { // St. Parametric 4EQ
-		{ "Trim"                      , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Band1 Type"                , "1_24", 9 , 0, 0, EVarType::Unsigned },
-		{ "Band4 Type"                , "2_24", 10, 0, 0, EVarType::Unsigned },
-		{ "Band2 Dynamic Gain Src"    , "3_24", 2 , 0, 3, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Band2 Dynamic Gain Amt [dB]", "4_24", 1 , 0, 1, EVarType::Signed, 2 , 4, 7 },
-		{ "Band1 Cutoff [Hz]"         , "5_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "6_24", 0 , 0, 0, EVarType::Unsigned, 1 , 2, 7 },
-		{ "Band1: Gain [dB]"          , "7_24", 0 , 1, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Band2: Q"                  , "9_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "10_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
-		{ "Band3 Cutoff[Hz]"          , "11_24", 4 , 0, 2, EVarType::Unsigned, 5 , 4, 7 },
-		{ "Band3: Q"                  , "12_24", 9 , 1, 7, EVarType::Unsigned },
-		{ "Band3: Gain [dB]"          , "13_24", 10, 1, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "14_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Band4: Q"                  , "15_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Band4: Gain [dB]"          , "16_24", 13, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "17_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "18_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "19_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[8] = { // St. Graphic 7EQ
-		{ "Type"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Trim"                      , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Band1 [dB]"                , "2_24", 2 , 0, 7, EVarType::Signed },
-		{ "Band2 [dB]"                , "3_24", 3 , 0, 7, EVarType::Signed },
-		{ "Band3 [dB]"                , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "Band4 [dB]"                , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Band5 [dB]"                , "6_24", 6 , 0, 7, EVarType::Signed },
-		{ "Band6 [dB]"                , "7_24", 7 , 0, 7, EVarType::Signed },
-		{ "Band7 [dB]"                , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[9] = { // St. Wah/Auto Wah
-		{ "Frequency Bottom"          , "0_24", 1 , 0, 6, EVarType::Unsigned },
-		{ "Frequency Top"             , "1_24", 0 , 0, 5, EVarType::Unsigned, 1 , 7, 7 },
-		{ "Sweep Mode"                , "2_24", 0 , 6, 7, EVarType::Unsigned },
-		{ "Sweep Mode: Src"           , "3_24", 3 , 0, 4, EVarType::Unsigned },
-		{ "Response"                  , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Sens"             , "5_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Envelope Shape"            , "6_24", 5 , 0, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "7_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "8_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
-		{ "LFO Frequency [Hz]: Amt"   , "9_24", 7 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "10_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "11_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "12_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Times"                     , "13_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "14_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Resonance"                 , "15_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Low Pass Filter"           , "16_24", 2 , 2, 2, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "17_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "18_24", 2 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "19_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[10] = { // St. Random Filter
-		{ "LFO Waveform"              , "0_24", 9 , 0, 0, EVarType::Unsigned },
-		{ "LFO Phase [degree]"        , "1_24", 11, 0, 5, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "2_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]: Src"   , "3_24", 12, 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]: Amt"   , "4_24", 2 , 0, 7, EVarType::Signed },
-		{ "LFO Step Freq [Hz]"        , "5_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Step Freq [Hz]: Amt"   , "6_24", 4 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "7_24", 12, 5, 5, EVarType::Unsigned },
-		{ "BPM"                       , "8_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "9_24", 14, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "10_24", 15, 0, 3, EVarType::Unsigned },
-		{ "Step Base Note"            , "11_24", 15, 4, 7, EVarType::Unsigned },
-		{ "Step Base Note: Times"     , "12_24", 14, 3, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "13_24", 12, 6, 6, EVarType::Unsigned },
-		{ "Manual"                    , "14_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "15_24", 9 , 1, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "16_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Depth: Amt"                , "17_24", 5 , 0, 7, EVarType::Signed },
-		{ "Resonance"                 , "18_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "19_24", 7 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "20_24", 10, 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 8 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[11] = { // St. Exciter/Enhncr
-		{ "Exciter Blend"             , "0_24", 0 , 0, 7, EVarType::Signed },
-		{ "Exciter Blend: Src"        , "1_24", 11, 0, 4, EVarType::Unsigned },
-		{ "Exciter Blend: Amt"        , "2_24", 1 , 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "3_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Emphatic Point: Src"       , "4_24", 10, 0, 1, EVarType::Unsigned, 11, 5, 7 },
-		{ "Emphatic Point: Amt"       , "5_24", 3 , 0, 7, EVarType::Signed },
-		{ "Enhancer Dly L [msec]"     , "6_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Enhancer Dly R [msec]"     , "7_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Enhancer Depth"            , "8_24", 9 , 0, 0, EVarType::Unsigned, 10, 2, 7 },
-		{ "Enhancer Depth: Src"       , "9_24", 15, 0, 4, EVarType::Unsigned },
-		{ "Enhancer Depth: Amt"       , "10_24", 6 , 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "11_24", 8 , 0, 6, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "12_24", 14, 0, 3, EVarType::Signed, 15, 5, 7 },
-		{ "Pre HEQ Gain [dB]"         , "13_24", 13, 0, 2, EVarType::Signed, 14, 4, 7 },
-		{ "Wet/Dry"                   , "14_24", 12, 0, 1, EVarType::Unsigned, 13, 3, 7 },
-		{ "Wet/Dry: Src"              , "15_24", 12, 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 7 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[12] = { // St. Sub Oscillator
-		{ "OSC Mode"                  , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Note Interval"             , "1_24", 1 , 0, 7, EVarType::Signed },
-		//{ "(Reserved)"                , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Note Fine"                 , "3_24", 3 , 0, 7, EVarType::Signed },
-		{ "Fixed Frequency [Hz]"      , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Fixed Frequency: Src"      , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Fixed Frequency: Amt"      , "6_24", 6 , 0, 7, EVarType::Signed },
-		{ "Envelope Pre LPF"          , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Sens"             , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Shape"            , "9_24", 9 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[13] = { // Talking Modulator
-		{ "Sweep Mode"                , "0_24", 0 , 0, 0, EVarType::Unsigned },
-		{ "Manual Voice Control"      , "1_24", 0 , 1, 7, EVarType::Unsigned },
-		{ "Manual Voice Control: Src" , "2_24", 1 , 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Voice Top"                 , "11_24", 1 , 5, 7, EVarType::Unsigned },
-		{ "Voice Center"              , "12_24", 2 , 0, 2, EVarType::Unsigned },
-		{ "Voice Bottom"              , "13_24", 2 , 3, 5, EVarType::Unsigned },
-		{ "Formant Shift"             , "14_24", 6 , 0, 7, EVarType::Signed },
-		{ "Resonance"                 , "15_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "16_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "17_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "18_24", 9 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[14] = { // Stereo Decimator
-		{ "Pre LPF"                   , "0_24", 4 , 0, 0, EVarType::Unsigned },
-		{ "Sampling Freq [Hz]"        , "1_24", 10, 0, 0, EVarType::Unsigned, 11, 0, 7 },
-		{ "Sampling Freq: Src"        , "2_24", 1 , 0, 4, EVarType::Unsigned },
-		{ "Sampling Freq: Amt"        , "3_24", 12, 0, 0, EVarType::Signed, 13, 0, 7 },
-		{ "High Damp [%]"             , "4_24", 4 , 1, 7, EVarType::Unsigned },
-		{ "Resolution"                , "5_24", 0 , 0, 2, EVarType::Unsigned, 1 , 5, 7 },
-		{ "Output Level"              , "6_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Output Level: Src"         , "7_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Output Level: Amt"         , "8_24", 6 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "9_24", 10, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 3 , 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 7 , 0, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "12_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "13_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
-		{ "LFO Frequency: Amt"        , "14_24", 9 , 0, 7, EVarType::Signed },
-		{ "Depth"                     , "15_24", 12, 1, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "16_24", 2 , 2, 6, EVarType::Unsigned },
-		{ "Depth: Amt"                , "17_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[15] = { // St. Analog Record
-		{ "Speed [RPM]"               , "0_24", 1 , 0, 1, EVarType::Unsigned },
-		{ "Flutter"                   , "1_24", 0 , 0, 0, EVarType::Unsigned, 1 , 2, 7 },
-		{ "Noise Density"             , "2_24", 0 , 1, 7, EVarType::Unsigned },
-		{ "Noise Tone"                , "3_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "Noise Level"               , "4_24", 5 , 0, 6, EVarType::Unsigned },
-		{ "Noise Level: Src"          , "5_24", 3 , 0, 4, EVarType::Unsigned },
-		{ "Noise Level: Amt"          , "6_24", 13, 0, 7, EVarType::Signed },
-		{ "Click Level"               , "7_24", 6 , 0, 6, EVarType::Unsigned },
-		{ "Click Level: Src"          , "8_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
-		{ "Click Level: Amt"          , "9_24", 14, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "10_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Pre EQ Cutoff [Hz]"        , "11_24", 8 , 0, 6, EVarType::Unsigned },
-		{ "Pre EQ Cutoff: Q"          , "12_24", 9 , 0, 6, EVarType::Unsigned },
-		{ "Pre EQ Cutoff: Gain [dB]"  , "13_24", 10, 0, 6, EVarType::Signed },
-		{ "Wet/Dry"                   , "14_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "15_24", 2 , 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[16] = { // St. Chorus
-		{ "LFO Waveform"              , "0_24", 12, 0, 0, EVarType::Unsigned },
-		{ "LFO Phase [degree]"        , "1_24", 12, 1, 6, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "2_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]: Src"   , "3_24", 11, 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "4_24", 1 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
-		{ "L Pre Delay [msec]"        , "10_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "R Pre Delay [msec]"        , "11_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "12_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "13_24", 10, 0, 1, EVarType::Unsigned, 11, 5, 7 },
-		{ "Depth: Amt"                , "14_24", 5 , 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "15_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "16_24", 10, 2, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "17_24", 6 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "18_24", 7 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "19_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "20_24", 9 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[17] = { // St. Harmonic Chorus
-		{ "LFO Waveform"              , "0_24", 3 , 0, 0, EVarType::Unsigned },
-		{ "LFO Phase [degree]"        , "1_24", 3 , 1, 5, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "2_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]: Src"   , "3_24", 2 , 0, 2, EVarType::Unsigned, 3 , 6, 7 },
-		{ "LFO Frequency: Amt"        , "4_24", 9 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Pre Delay [msec]"          , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "11_24", 1 , 0, 1, EVarType::Unsigned, 2 , 3, 7 },
-		{ "Depth: Src"                , "12_24", 7 , 0, 4, EVarType::Unsigned },
-		{ "Depth: Amt"                , "13_24", 11, 0, 7, EVarType::Signed },
-		{ "High/Low Split Point"      , "14_24", 0 , 0, 0, EVarType::Unsigned, 1 , 2, 7 },
-		{ "Feedback"                  , "15_24", 12, 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "16_24", 0 , 1, 7, EVarType::Unsigned },
-		{ "Low Level"                 , "17_24", 6 , 0, 3, EVarType::Unsigned, 7 , 5, 7 },
-		{ "High Level"                , "18_24", 5 , 0, 2, EVarType::Unsigned, 6 , 4, 7 },
-		{ "Wet/Dry"                   , "19_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "20_24", 5 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 4 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[18] = { // Multitap Cho/Dly
-		{ "LFO Frequency [Hz]"        , "0_24", 12, 0, 2, EVarType::Unsigned, 13, 5, 7 },
-		{ "Tap1 (000) [msec]"         , "1_24", 14, 0, 5, EVarType::Unsigned, 15, 7, 7 },
-		{ "Tap1: Depth"               , "2_24", 10, 0, 1, EVarType::Unsigned, 11, 5, 7 },
-		{ "Tap1: Level"               , "3_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Tap1: Pan"                 , "4_24", 3 , 4, 7, EVarType::Signed },
-		{ "Tap2 (180) [msec]"         , "5_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
-		{ "Tap2: Depth"               , "6_24", 9 , 0, 3, EVarType::Unsigned, 10, 7, 7 },
-		{ "Tap2: Level"               , "7_24", 6 , 0, 1, EVarType::Unsigned, 7 , 5, 7 },
-		{ "Tap2: Pan"                 , "8_24", 4 , 4, 7, EVarType::Signed },
-		{ "Tap3 (090) [msec]"         , "9_24", 13, 0, 4, EVarType::Unsigned, 14, 6, 7 },
-		{ "Tap3: Depth"               , "10_24", 10, 2, 6, EVarType::Unsigned },
-		{ "Tap3: Level"               , "11_24", 7 , 0, 4, EVarType::Unsigned },
-		{ "Tap3: Pan"                 , "12_24", 4 , 0, 3, EVarType::Signed },
-		{ "Tap4 (270) [msec]"         , "13_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Tap4: Depth"               , "14_24", 11, 0, 4, EVarType::Unsigned },
-		{ "Tap4: Level"               , "15_24", 12, 3, 7, EVarType::Unsigned },
-		{ "Tap4: Pan"                 , "16_24", 3 , 0, 3, EVarType::Signed },
-		{ "Tap1 Feedback"             , "17_24", 0 , 0, 7, EVarType::Signed },
-		{ "Tap1 Feedback: Amt"        , "18_24", 1 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "19_24", 5 , 0, 5, EVarType::Unsigned, 6 , 7, 7 },
-		{ "Tap1 Feedback: Src"        , "20_24", 6 , 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 2 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[19] = { // Ensemble
-		{ "Speed"                     , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Speed: Src"                , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Speed: Amt"                , "2_24", 2 , 0, 7, EVarType::Signed },
-		{ "Depth"                     , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Amt"                , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Shimmer"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 9 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[20] = { // Stereo Flanger
-		{ "Delay Time [msec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "LFO Waveform"              , "1_24", 12, 0, 0, EVarType::Unsigned },
-		{ "LFO Shape"                 , "2_24", 1 , 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "3_24", 12, 1, 6, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "4_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "5_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "6_24", 4 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "7_24", 13, 0, 7, EVarType::Unsigned },
-		{ "BPM"                       , "8_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "9_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "10_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "11_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Depth"                     , "12_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "13_24", 6 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "14_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "15_24", 9 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "16_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "17_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[21] = { // St. Random Flanger
-		{ "Delay Time [msec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "LFO Waveform"              , "1_24", 11, 0, 0, EVarType::Unsigned },
-		{ "LFO Phase [degree]"        , "2_24", 11, 1, 6, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "4_24", 12, 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "5_24", 2 , 0, 7, EVarType::Signed },
-		{ "LFO Step Freq [Hz]"        , "6_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Step Freq: Amt"        , "7_24", 4 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "8_24", 12, 5, 5, EVarType::Unsigned },
-		{ "BPM"                       , "9_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "10_24", 14, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "11_24", 15, 0, 3, EVarType::Unsigned },
-		{ "Step Base Note"            , "12_24", 15, 4, 7, EVarType::Unsigned },
-		{ "Step Base Note: Times"     , "13_24", 14, 3, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "14_24", 12, 6, 6, EVarType::Unsigned },
-		{ "Depth"                     , "15_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "16_24", 6 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "17_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "18_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "19_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "20_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[22] = { // St. Env. Flanger
-		{ "L Dly Bottom [msec]"       , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "L Dly Top [msec]"          , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "R Dly Bottom [msec]"       , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "R Dly Top [msec]"          , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Sweep Mode"                , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Sweep Mode: Src"           , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "EG Attack"                 , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "EG Delay"                  , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "10_24", 10, 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "11_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[23] = { // Stereo Phaser
-		{ "LFO Waveform"              , "0_24", 12, 0, 0, EVarType::Unsigned },
-		{ "LFO Shape"                 , "1_24", 0 , 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "2_24", 12, 1, 6, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "4_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Amt"       , "5_24", 3 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Manual"                    , "11_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "12_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "13_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Amt"                , "14_24", 7 , 0, 7, EVarType::Signed },
-		{ "Resonance"                 , "15_24", 8 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "16_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "17_24", 9 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "18_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "19_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[24] = { // St. Random Phaser
-		{ "LFO Waveform"              , "0_24", 11, 0, 1, EVarType::Unsigned },
-		{ "LFO Phase [degree]"        , "1_24", 11, 2, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "2_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "3_24", 12, 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency : Amt"       , "4_24", 2 , 0, 7, EVarType::Signed },
-		{ "LFO Step Freq [Hz]"        , "5_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Step Freq: Amt"        , "6_24", 4 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "7_24", 12, 5, 5, EVarType::Unsigned },
-		{ "BPM"                       , "8_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "9_24", 14, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "10_24", 15, 0, 3, EVarType::Unsigned },
-		{ "Step Base Note"            , "11_24", 15, 4, 7, EVarType::Unsigned },
-		{ "Step Base Note: Times"     , "12_24", 14, 3, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "13_24", 12, 6, 6, EVarType::Unsigned },
-		{ "Manual"                    , "14_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "15_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Resonance"                 , "16_24", 6 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "17_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "18_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "19_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "20_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[25] = { // St. Env Phaser
-		{ "L Manu Bottom"             , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "L Manu Top"                , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "R Manu Bottom"             , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "R Manu Top"                , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Sweep Mode"                , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Sweep Mode: Src"           , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "EG Attack"                 , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "EG Delay"                  , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Resonance"                 , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "10_24", 10, 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "11_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[26] = { // St.Biphase Mod.
-		{ "LFO1 Waveform"             , "0_24", 3 , 7, 7, EVarType::Unsigned },
-		{ "LFO2 Waveform"             , "1_24", 4 , 7, 7, EVarType::Unsigned },
-		{ "LFO Phase Sw"              , "2_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "LFO1 Frequency [Hz]"       , "3_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "LFO1 Frequency: Src"       , "4_24", 14, 2, 6, EVarType::Unsigned },
-		{ "LFO1 Frequency: Amt"       , "5_24", 8 , 0, 7, EVarType::Signed },
-		{ "LFO2 Frequency [Hz]"       , "6_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO2 Frequency: Amt"       , "7_24", 9 , 0, 7, EVarType::Signed },
-		{ "Depth1"                    , "8_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Depth1: Src"               , "9_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
-		{ "Depth1: Amt"               , "10_24", 10, 0, 7, EVarType::Signed },
-		{ "Depth2"                    , "11_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "Depth2: Amt"               , "12_24", 11, 0, 7, EVarType::Signed },
-		{ "L Pre Delay [msec]"        , "13_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "R Pre Delay [msec]"        , "14_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "15_24", 5 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "16_24", 6 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "17_24", 7 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "18_24", 15, 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "19_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[27] = { // Stereo Vibrato
-		{ "LFO Waveform"              , "0_24", 1 , 0, 0, EVarType::Unsigned },
-		{ "LFO Shape"                 , "1_24", 2 , 0, 7, EVarType::Signed },
-		{ "LFO Frequency Mod"         , "2_24", 12, 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Freqency: Src"         , "4_24", 1 , 1, 5, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "5_24", 4 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Depth"                     , "11_24", 12, 1, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "12_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Depth: Amt"                , "13_24", 5 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "14_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "15_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 6 , 0, 7, EVarType::Signed },
-		{ "AUTOFADE Src"              , "17_24", 10, 0, 4, EVarType::Unsigned },
-		{ "Fade-In Rate"              , "18_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Fade-In Delay [msec]"      , "19_24", 7 , 0, 7, EVarType::Unsigned } };
-
-	effect_conversions[28] = { // St. Auto Fade Mod.
-		{ "LFO Waveform"              , "0_24", 5 , 0, 0, EVarType::Unsigned },
-		{ "LFO Shape"                 , "1_24", 10, 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "2_24", 5 , 1, 4, EVarType::Signed },
-		{ "LFO Frequency Mod"         , "3_24", 5 , 5, 5, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "4_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "5_24", 4 , 0, 2, EVarType::Unsigned, 5 , 6, 7 },
-		{ "LFO Frequency: Amt"        , "6_24", 8 , 0, 7, EVarType::Signed },
-		{ "L Delay Time [msec]"       , "7_24", 2 , 0, 4, EVarType::Unsigned, 3 , 0, 7 },
-		{ "R Delay Time [msec]"       , "8_24", 0 , 0, 1, EVarType::Unsigned, 1 , 0, 7, Byte(2, 5, 7) },
-		{ "Depth"                     , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "10_24", 11, 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "11_24", 6 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry Mod"               , "12_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "13_24", 13, 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "14_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 14, 0, 7, EVarType::Signed },
-		{ "AUTOFADE Src"              , "16_24", 0 , 2, 6, EVarType::Unsigned },
-		{ "Fade-In Rate"              , "17_24", 12, 0, 6, EVarType::Unsigned },
-		{ "Fade-In Dly [msec]"        , "18_24", 15, 0, 7, EVarType::Unsigned } };
-
-	effect_conversions[29] = { // 2Voice Resonator
-		{ "Control Mode"              , "0_24", 12, 4, 5, EVarType::Unsigned },
-		{ "LFO/D-mod Invert"          , "1_24", 1 , 7, 7, EVarType::Unsigned },
-		{ "D-mod Src"                 , "2_24", 8 , 0, 1, EVarType::Unsigned, 9 , 5, 7 },
-		{ "Trim"                      , "3_24", 1 , 0, 6, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Mod. Depth"                , "5_24", 6 , 0, 7, EVarType::Signed },
-		{ "Voice1: Pitch"             , "6_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Voice2: Pitch"             , "7_24", 14, 0, 5, EVarType::Unsigned, 15, 7, 7 },
-		{ "Voice1: Resonance"         , "8_24", 2 , 0, 7, EVarType::Signed },
-		{ "Voice2: Resonance"         , "9_24", 3 , 0, 7, EVarType::Signed },
-		{ "Voice1: High Damp [%]"     , "10_24", 13, 0, 4, EVarType::Unsigned, 14, 6, 7 },
-		{ "Voice2: High Damp [%]"     , "11_24", 12, 0, 3, EVarType::Unsigned, 13, 5, 7 },
-		{ "Voice1: Level"             , "12_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Voice2: Level"             , "13_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
-		{ "Voice1: Pan"               , "14_24", 7 , 0, 3, EVarType::Signed },
-		{ "Voice2: Pan"               , "15_24", 7 , 4, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "16_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
-		{ "Wet/Dry: Src"              , "17_24", 8 , 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "18_24", 5 , 0, 7, EVarType::Signed },
-		{ "Voice1: Fine [cent]"       , "19_24", 0 , 0, 3, EVarType::Signed },
-		{ "Voice2: Fine [cent]"       , "20_24", 0 , 4, 7, EVarType::Signed } };
-
-	effect_conversions[30] = { // Doppler
-		{ "LFO Mode"                  , "0_24", 4 , 0, 0, EVarType::Unsigned },
-		{ "LFO Mode: Src"             , "1_24", 3 , 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "2_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Src"       , "3_24", 2 , 0, 1, EVarType::Unsigned, 3 , 5, 7 },
-		{ "LFO Frequency : Amt"       , "4_24", 6 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Pitch Depth"               , "10_24", 1 , 0, 0, EVarType::Unsigned, 2 , 2, 7 },
-		{ "Pitch Depth: Src"          , "11_24", 1 , 1, 5, EVarType::Unsigned },
-		{ "Pitch Depth: Amt"          , "12_24", 7 , 0, 7, EVarType::Signed },
-		{ "Pan Depth"                 , "13_24", 8 , 0, 7, EVarType::Signed },
-		{ "Pan Depth: Src"            , "14_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Pan Depth: Amt"            , "15_24", 9 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "16_24", 4 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "17_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "18_24", 10, 0, 7, EVarType::Signed },
-		{ "LFO Sync"                  , "19_24", 13, 1, 1, EVarType::Unsigned } };
-
-	effect_conversions[31] = { // Scratch
-		{ "Scratch Source"            , "0_24", 5 , 1, 5, EVarType::Unsigned },
-		{ "Scratch Response"          , "1_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Select"           , "2_24", 2 , 0, 0, EVarType::Unsigned },
-		{ "Envelope Select: Src"      , "3_24", 1 , 1, 5, EVarType::Unsigned },
-		{ "Threshold"                 , "4_24", 2 , 1, 7, EVarType::Unsigned },
-		{ "Response"                  , "5_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Direct Mix"                , "6_24", 1 , 6, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "7_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "8_24", 4 , 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 0 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[32] = { // Stereo Tremolo
-		{ "LFO Waveform"              , "0_24", 9 , 0, 2, EVarType::Unsigned },
-		{ "LFO Shape"                 , "1_24", 0 , 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "2_24", 12, 1, 6, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Src"       , "4_24", 9 , 3, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Amt"       , "5_24", 2 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Depth"                     , "11_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "12_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Amt"                , "13_24", 5 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "14_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "15_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 8 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[33] = { // St. Env. Tremolo
-		{ "Envelope Sens"             , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Shape"            , "1_24", 1 , 0, 7, EVarType::Signed },
-		{ "LFO Waveform"              , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "LFO Shape"                 , "3_24", 3 , 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Amount [Hz]"      , "6_24", 6 , 0, 7, EVarType::Signed },
-		{ "Depth"                     , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Envelope Amount"           , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[34] = { // Stereo Auto Pan
-		{ "LFO Waveform"              , "0_24", 9 , 0, 0, EVarType::Unsigned },
-		{ "LFO Shape"                 , "1_24", 0 , 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "2_24", 12, 1, 6, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "3_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Src"       , "4_24", 9 , 3, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Amt"       , "5_24", 2 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "6_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "7_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "8_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "9_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "10_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Depth"                     , "11_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Src"                , "12_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Amt"                , "13_24", 5 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "14_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "15_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 8 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[35] = { // St. Phaser + Trml
-		{ "Type"                      , "0_24", 0 , 0, 2, EVarType::Unsigned },
-		{ "LFO Phase [degree]"        , "1_24", 1 , 0, 2, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency : Src"       , "3_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "4_24", 3 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Phaser Manual"             , "10_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Phaser Depth"              , "11_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Phaser Depth: Src"         , "12_24", 1 , 3, 7, EVarType::Unsigned },
-		{ "Phaser Depth: Amt"         , "13_24", 6 , 0, 4, EVarType::Signed, 7 , 6, 7 },
-		{ "Resonance"                 , "14_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
-		{ "Phaser Wet/Dry"            , "15_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
-		{ "Tremolo Shape"             , "16_24", 11, 0, 6, EVarType::Signed },
-		{ "Tremolo Depth"             , "17_24", 10, 0, 4, EVarType::Unsigned, 11, 7, 7 },
-		{ "Tremolo Depth: Src"        , "18_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Tremolo Depth: Amt"        , "19_24", 9 , 0, 3, EVarType::Signed, 10, 5, 7 },
-		{ "Wet/Dry"                   , "20_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
-		{ "Wet/Dry: Src"              , "21_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "22_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[36] = { // St. Ring Modulator
-		{ "Pre LPF"                   , "0_24", 6 , 0, 6, EVarType::Unsigned },
-		{ "OSC Mode"                  , "1_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "Fixed Frequency [Hz]"      , "2_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Fixed Frequency: Src"      , "3_24", 3 , 0, 4, EVarType::Unsigned },
-		{ "Fixed Frequency: Amt"      , "4_24", 2 , 0, 4, EVarType::Signed, 3 , 5, 7 },
-		{ "Note Offset"               , "5_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
-		{ "(Reserved)"                , "6_24", 0 , 0, 0, EVarType::Unsigned, 1 , 4, 7 },
-		{ "Note Fine"                 , "7_24", 8 , 0, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "8_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "9_24", 5 , 0, 4, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "10_24", 10, 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "11_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "12_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "13_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "14_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "15_24", 15, 7, 7, EVarType::Unsigned },
-		{ "LFO Depth"                 , "16_24", 13, 1, 7, EVarType::Unsigned },
-		{ "LFO Depth: Src"            , "17_24", 4 , 0, 1, EVarType::Unsigned, 5 , 5, 7 },
-		{ "LFO Depth: Amt"            , "18_24", 11, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "19_24", 0 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "20_24", 4 , 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[37] = { // Detune
-		{ "Pitch Shift [cent]"        , "0_24", 0 , 0, 7, EVarType::Signed },
-		{ "Pitch Shift: Src"          , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Pitch Shift: Amt"          , "2_24", 2 , 0, 7, EVarType::Signed },
-		{ "Delay Time [msec]"         , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Input Level: Src"          , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Input Level Dmod [%]"      , "7_24", 7 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "10_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[38] = { // Pitch Shifter
-		{ "Mode"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Pitch Shift [1/2tone]"     , "1_24", 1 , 0, 7, EVarType::Signed },
-		{ "Pitch Shift: Src"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Pitch Shift: Amt"          , "3_24", 3 , 0, 7, EVarType::Signed },
-		{ "Fine [cent]"               , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "Fine: Amt"                 , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Delay Time [msec]"         , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Feedback Position"         , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Input Level: Src"          , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Input Level Dmod [%]"      , "11_24", 11, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "12_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "13_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "14_24", 14, 0, 7, EVarType::Signed } };
-
-	effect_conversions[39] = { // Pitch Shift Mod.
-		{ "Pitch Shift [cent]"        , "0_24", 0 , 0, 7, EVarType::Signed },
-		{ "LFO Waveform"              , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Src"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "LFO Frequency: Amt"        , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "BPM/MIDI Sync"             , "5_24", 13, 0, 0, EVarType::Unsigned },
-		{ "BPM"                       , "6_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Base Note"                 , "7_24", 15, 0, 2, EVarType::Unsigned },
-		{ "Base Note: Times"          , "8_24", 15, 3, 6, EVarType::Unsigned },
-		//{ "(Reserved)"                , "9_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Depth"                     , "10_24", 5 , 0, 7, EVarType::Signed },
-		{ "Depth: Src"                , "11_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Depth: Amt"                , "12_24", 7 , 0, 7, EVarType::Signed },
-		{ "Pan"                       , "13_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "14_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "15_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[40] = { // Rotary Speaker
-		{ "Mode Switch"               , "0_24", 0 , 0, 0, EVarType::Unsigned },
-		{ "Mode Switch: Src"          , "1_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Mode Switch: Sw"           , "2_24", 0 , 2, 2, EVarType::Unsigned },
-		{ "Speed Switch"              , "3_24", 0 , 1, 1, EVarType::Unsigned },
-		{ "Speed Switch: Src"         , "4_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Speed Switch: Sw"          , "5_24", 0 , 3, 3, EVarType::Unsigned },
-		{ "Manual Speed Ctrl"         , "6_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Rotor Acceleration"        , "7_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Rotor Ratio"               , "8_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Horn Acceleration"         , "9_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Horn Ratio"                , "10_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Horn/Rotor Balance"        , "11_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Mic Distance"              , "12_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Mic Spread"                , "13_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "14_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "15_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 13, 0, 7, EVarType::Signed } };
-
-	effect_conversions[41] = { // Early Reflections
-		{ "Type"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "ER Time [msec]"            , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "EQ Trim"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "8_24", 8 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[42] = { // Auto Reverse
-		{ "Rec Mode"                  , "0_24", 1 , 0, 0, EVarType::Unsigned },
-		{ "Envelope Select"           , "1_24", 2 , 0, 0, EVarType::Unsigned },
-		{ "Envelope: Src"             , "2_24", 1 , 1, 5, EVarType::Unsigned },
-		{ "Threshold"                 , "3_24", 2 , 1, 7, EVarType::Unsigned },
-		{ "Direct Mix"                , "4_24", 1 , 6, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "5_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "6_24", 4 , 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "7_24", 0 , 0, 7, EVarType::Signed },
-		{ "Reverse Time [msec]"       , "8_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Response"                  , "9_24", 6 , 0, 7, EVarType::Unsigned } };
-
-	effect_conversions[43] = { // L/C/R Delay
-		{ "L Delay Time [msec]"       , "0_24", 2 , 0, 3, EVarType::Unsigned, 3 , 0, 7 },
-		{ "L Delay Level"             , "1_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "C Delay Time [msec]"       , "2_24", 1 , 0, 7, EVarType::Unsigned, 2 , 4, 7 },
-		{ "C Delay Level"             , "3_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
-		{ "R Delay Time [msec]"       , "4_24", 5 , 0, 7, EVarType::Unsigned, 6 , 4, 7 },
-		{ "R Delay Level"             , "5_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Feedback (C Delay)"        , "6_24", 0 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "7_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Feedback: Amt"             , "8_24", 4 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "9_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
-		{ "Low Damp [%]"              , "10_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Input Level: Src"          , "11_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
-		{ "Input Level Dmod [%]"      , "12_24", 8 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "13_24", 9 , 2, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "14_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
-		{ "Wet/Dry: Src"              , "15_24", 13, 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[44] = { // Stereo/Cross Delay
-		{ "L Delay Time [msec]"       , "0_24", 14, 0, 5, EVarType::Unsigned, 15, 0, 7 },
-		{ "R Delay Time [msec]"       , "1_24", 12, 0, 3, EVarType::Unsigned, 13, 0, 7, Byte(14, 6, 7 )},
-		{ "Wet/Dry"                   , "2_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "3_24", 8 , 0, 1, EVarType::Unsigned, 9 , 5, 7 },
-		{ "Wet/Dry: Amt"              , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "L Feedback"                , "5_24", 0 , 0, 7, EVarType::Signed },
-		{ "R Feedback"                , "6_24", 1 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "7_24", 8 , 2, 6, EVarType::Unsigned },
-		{ "L Feedback: Amt"           , "8_24", 2 , 0, 7, EVarType::Signed },
-		{ "R Feedback: Amt"           , "9_24", 3 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "10_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
-		{ "Low Damp [%]"              , "11_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Input Level Src"           , "12_24", 6 , 0, 3, EVarType::Unsigned, 7 , 7, 7 },
-		{ "Input Level Dmod [%]"      , "13_24", 5 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "14_24", 10, 0, 5, EVarType::Signed, 11, 7, 7 },
-		{ "Stereo/Cross"              , "15_24", 8 , 7, 7, EVarType::Unsigned } };
-
-	effect_conversions[45] = { // St. Multitap Delay
-		{ "Tap1 Time [msec]"          , "0_24", 10, 0, 4, EVarType::Unsigned, 11, 0, 7 },
-		{ "Tap2 Time [msec]"          , "1_24", 14, 0, 4, EVarType::Unsigned, 15, 0, 7 },
-		{ "Wet/Dry"                   , "2_24", 9 , 0, 3, EVarType::Unsigned, 10, 5, 7 },
-		{ "Wet/Dry: Src"              , "3_24", 7 , 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "Feedback (Tap2)"           , "5_24", 0 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "6_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Feedback: Amt"             , "7_24", 1 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "8_24", 13, 0, 3, EVarType::Unsigned, 14, 5, 7 },
-		{ "Low Damp [%]"              , "9_24", 12, 0, 2, EVarType::Unsigned, 13, 4, 7 },
-		{ "Input Level Src"           , "10_24", 6 , 0, 1, EVarType::Unsigned, 7 , 5, 7 },
-		{ "Input Level Dmod [%]"      , "11_24", 5 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "12_24", 2 , 0, 7, EVarType::Signed },
-		{ "Spread: Src"               , "13_24", 12, 3, 7, EVarType::Unsigned },
-		{ "Spread: Amt"               , "14_24", 3 , 0, 7, EVarType::Signed },
-		{ "Mode"                      , "15_24", 6 , 2, 3, EVarType::Unsigned },
-		{ "Tap1 Level"                , "16_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 } };
-
-	effect_conversions[46] = { // St. Modulation Delay
-		{ "Modulation Mode"           , "0_24", 7 , 6, 6, EVarType::Unsigned },
-		{ "D-mod Modulation: Src"     , "1_24", 9 , 2, 6, EVarType::Unsigned },
-		{ "Response"                  , "2_24", 11, 0, 6, EVarType::Unsigned },
-		{ "LFO Waveform"              , "3_24", 7 , 7, 7, EVarType::Unsigned },
-		{ "LFO Shape"                 , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "LFO Sync"                  , "6_24", 9 , 7, 7, EVarType::Unsigned },
-		{ "LFO Sync: Src"             , "7_24", 9 , 0, 1, EVarType::Unsigned, 10, 5, 7 },
-		{ "L LFO Phase [degree]"      , "8_24", 7 , 0, 5, EVarType::Signed },
-		{ "R LFO Phase [degree]"      , "9_24", 12, 2, 7, EVarType::Signed },
-		{ "L Depth"                   , "10_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "R Depth"                   , "11_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "L Delay Time [msec]"       , "12_24", 14, 0, 4, EVarType::Unsigned, 15, 0, 7 },
-		{ "R Delay Time [msec]"       , "13_24", 12, 0, 1, EVarType::Unsigned, 13, 0, 7, Byte(14, 5, 7) },
-		{ "L Feedback"                , "14_24", 0 , 0, 7, EVarType::Signed },
-		{ "R Feedback"                , "15_24", 1 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "16_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry: Src"              , "17_24", 10, 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "18_24", 6 , 0, 7, EVarType::Signed },
-		{ "D-mod Modulation"          , "19_24", 11, 7, 7, EVarType::Unsigned } };
-
-	effect_conversions[47] = { // St. Dynamic Delay
-		{ "Control Target"            , "0_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Polarity"                  , "1_24", 11, 0, 0, EVarType::Unsigned },
-		{ "Threshold"                 , "2_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Attack"                    , "3_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Release"                   , "4_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "L Delay Time [msec]"       , "5_24", 12, 0, 7, EVarType::Unsigned, 13, 0, 7 },
-		{ "R Delay Time [msec]"       , "6_24", 14, 0, 7, EVarType::Unsigned, 15, 0, 7 },
-		{ "Wet/Dry"                   , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 9 , 0, 7, EVarType::Signed },
-		{ "Feedback"                  , "10_24", 3 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "11_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Low Damp [%]"              , "12_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Spread"                    , "13_24", 6 , 0, 7, EVarType::Signed },
-		{ "Offset"                    , "14_24", 11, 1, 7, EVarType::Unsigned } };
-
-	effect_conversions[48] = { // St. Auto Panning Dly
-		{ "L Delay Time [msec]"       , "0_24", 2 , 0, 4, EVarType::Unsigned, 3 , 0, 7 },
-		{ "R Delay Time [msec]"       , "1_24", 0 , 0, 1, EVarType::Unsigned, 1 , 0, 7, Byte(2, 5, 7) },
-		{ "L Feedback"                , "2_24", 6 , 0, 7, EVarType::Signed },
-		{ "R Feedback"                , "3_24", 7 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "4_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Low Damp [%]"              , "5_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "LFO Waveform"              , "6_24", 5 , 0, 0, EVarType::Unsigned },
-		{ "LFO Shape"                 , "7_24", 10, 0, 7, EVarType::Signed },
-		{ "LFO Phase [degree]"        , "8_24", 0 , 2, 7, EVarType::Signed },
-		{ "Panning Frequency [Hz]"    , "9_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Panning Depth"             , "10_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Panning Depth: Src"        , "11_24", 5 , 1, 5, EVarType::Unsigned },
-		{ "Panning Depth: Amt"        , "12_24", 12, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "13_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 4 , 0, 2, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[49] = { // L/C/R BPM Delay
-		{ "BPM"                       , "0_24", 5 , 0, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "1_24", 1 , 2, 2, EVarType::Unsigned },
-		{ "L Delay Base Note"         , "2_24", 3 , 0, 2, EVarType::Unsigned },
-		{ "L Delay Base Note: Times"  , "3_24", 6 , 4, 7, EVarType::Unsigned },
-		{ "L Delay Level"             , "4_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "C Delay Base Note"         , "5_24", 3 , 3, 5, EVarType::Unsigned },
-		{ "C Delay Base Note: Times"  , "6_24", 2 , 1, 4, EVarType::Unsigned },
-		{ "C Delay Level"             , "7_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
-		{ "R Delay Base Note"         , "8_24", 2 , 0, 0, EVarType::Unsigned, 3 , 6, 7 },
-		{ "R Delay Base Note: Times"  , "9_24", 1 , 0, 0, EVarType::Unsigned, 2 , 5, 7 },
-		{ "R Delay Level"             , "10_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Time Over? >"              , "11_24", 1 , 1, 1, EVarType::Signed },
-		{ "Feedback (C Delay)"        , "12_24", 0 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "13_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Feedback: Amt"             , "14_24", 4 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "15_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
-		{ "Low Damp [%]"              , "16_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Input Level Src"           , "17_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
-		{ "Input Level Dmod [%]"      , "18_24", 8 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "19_24", 9 , 2, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "20_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
-		{ "Wet/Dry: Src"              , "21_24", 13, 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "22_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[50] = { // St. BPM Delay
-		{ "BPM"                       , "0_24", 4 , 0, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "1_24", 9 , 7, 7, EVarType::Unsigned },
-		{ "L Delay Base Note"         , "2_24", 5 , 0, 2, EVarType::Unsigned },
-		{ "L Delay Base Note: Times"  , "3_24", 5 , 3, 6, EVarType::Unsigned },
-		{ "L Delay: Adjust [%]"       , "4_24", 10, 0, 7, EVarType::Signed, 11, 7, 7 },
-		{ "Time Over? L >"            , "5_24", 5 , 7, 7, EVarType::Signed },
-		{ "R Delay Base Note"         , "6_24", 6 , 0, 2, EVarType::Unsigned },
-		{ "R Delay Base Note: Times"  , "7_24", 6 , 3, 6, EVarType::Unsigned },
-		{ "R Delay: Adjust [%]"       , "8_24", 12, 0, 7, EVarType::Signed, 13, 7, 7 },
-		{ "Time Over? R >"            , "9_24", 6 , 7, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "10_24", 9 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 14, 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 8 , 0, 7, EVarType::Signed },
-		{ "L Feedback"                , "13_24", 0 , 0, 7, EVarType::Signed },
-		{ "R Feedback"                , "14_24", 1 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "15_24", 15, 0, 4, EVarType::Unsigned },
-		{ "L Feedback: Amt"           , "16_24", 2 , 0, 7, EVarType::Signed },
-		{ "R Feedback: Amt"           , "17_24", 3 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "18_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Low Damp [%]"              , "19_24", 13, 0, 6, EVarType::Unsigned },
-		{ "Input Level Src"           , "20_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
-		{ "Input Level Dmod [%]"      , "21_24", 7 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[51] = { // Sequence Delay
-		{ "BPM"                       , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "1_24", 6 , 0, 0, EVarType::Unsigned },
-		{ "Rhythm Pattern"            , "2_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Feedback"                  , "3_24", 2 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "4_24", 15, 0, 4, EVarType::Unsigned },
-		{ "Feedback: Amt"             , "5_24", 3 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "6_24", 6 , 1, 7, EVarType::Unsigned },
-		{ "Low Damp [%]"              , "7_24", 7 , 1, 7, EVarType::Unsigned },
-		{ "Input Level Src"           , "8_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
-		{ "Input Level Dmod [%]"      , "9_24", 4 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "10_24", 13, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 14, 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 5 , 0, 7, EVarType::Signed },
-		{ "Tap1 Pan"                  , "13_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Tap2 Pan"                  , "14_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
-		{ "Tap3 Pan"                  , "15_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
-		{ "Tap4 Pan"                  , "16_24", 8 , 0, 3, EVarType::Unsigned, 9 , 5, 7 } };
-
-	effect_conversions[52] = // Reverb Hall
-	effect_conversions[53] = // Reverb SmoothHall
-	effect_conversions[54] = // Reverb Wet Plate
-	effect_conversions[55] = { // Reverb Dry Plate
-		{ "Reverb Time [sec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "High Damp [%]"             , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Pre Delay Thru [%]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "EQ Trim"                   , "4_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "5_24", 7 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "6_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "7_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "8_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[56] = // Reverb Room
-	effect_conversions[57] = { // Reverb BrightRoom
-		{ "Reverb Time [sec]"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "High Damp [%]"             , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Pre Delay Thru [%]"        , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "ER Level"                  , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Reverb Level"              , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "EQ Trim"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "7_24", 7 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "8_24", 8 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "9_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[58] = { // P4EQ - Exciter
-		{ "Trim"                      , "0_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
-		{ "Exciter Blend"             , "13_24", 14, 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "14_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "15_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "16_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "17_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[59] = { // P4EQ - Wah
-		{ "Trim"                      , "0_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
-		{ "Frequency Bottom"          , "13_24", 9 , 0, 5, EVarType::Unsigned },
-		{ "Frequency Top"             , "14_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Sweep Mode"                , "15_24", 11, 6, 7, EVarType::Unsigned },
-		{ "Sweep Mode: Src"           , "16_24", 8 , 0, 2, EVarType::Unsigned, 9 , 6, 7 },
-		{ "LFO Frequency [Hz]"        , "17_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Resonance"                 , "18_24", 14, 0, 6, EVarType::Unsigned },
-		{ "LPF"                       , "19_24", 14, 7, 7, EVarType::Unsigned },
-		{ "Routing"                   , "20_24", 13, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "21_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "22_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[60] = { // P4EQ  - Cho/Flng
-		{ "Trim"                      , "0_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
-		{ "Delay Time [msec]"         , "13_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
-		{ "LFO Waveform"              , "14_24", 12, 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "15_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "16_24", 9 , 0, 3, EVarType::Unsigned, 10, 6, 7 },
-		{ "Feedback"                  , "17_24", 8 , 0, 2, EVarType::Signed, 9 , 4, 7 },
-		{ "Cho/Flg Wet/Dry"           , "18_24", 12, 1, 7, EVarType::Signed },
-		{ "Output Mode"               , "19_24", 13, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "20_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "21_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "22_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[61] = { // P4EQ - Phaser
-		{ "Trim"                      , "0_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
-		{ "LFO Waveform"              , "13_24", 12, 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "14_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Manual"                    , "15_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
-		{ "Depth"                     , "16_24", 9 , 0, 3, EVarType::Unsigned, 10, 6, 7 },
-		{ "Resonance"                 , "17_24", 8 , 0, 2, EVarType::Signed, 9 , 4, 7 },
-		{ "Phaser Wet/Dry"            , "18_24", 12, 1, 7, EVarType::Signed },
-		{ "Output Mode"               , "19_24", 13, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "20_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "21_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "22_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[62] = { // P4EQ - Mt. Delay
-		{ "Trim"                      , "0_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Band1 Cutoff [Hz]"         , "1_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "2_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "3_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "4_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "5_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "6_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "7_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "8_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "9_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "10_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "11_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "12_24", 6 , 2, 7, EVarType::Signed },
-		{ "Tap1 Delay Time [msec]"    , "13_24", 10, 0, 4, EVarType::Unsigned, 11, 6, 7 },
-		{ "Tap2 Delay Time [msec]"    , "14_24", 9 , 0, 3, EVarType::Unsigned, 10, 5, 7 },
-		{ "Tap1 Level"                , "15_24", 8 , 0, 0, EVarType::Unsigned, 9 , 4, 7 },
-		{ "Feedback (Tap2)"           , "16_24", 8 , 1, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "17_24", 15, 0, 5, EVarType::Unsigned },
-		{ "Mt.Delay Wet/Dry"          , "18_24", 14, 0, 3, EVarType::Unsigned, 15, 6, 7 },
-		{ "Wet/Dry"                   , "19_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
-		{ "Wet/Dry: Src"              , "20_24", 13, 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[63] = { // Comp - Wah
-		{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "CMP: Output Level"         , "2_24", 5 , 0, 6, EVarType::Unsigned },
-		{ "Frequency Bottom"          , "3_24", 4 , 0, 5, EVarType::Unsigned, 5 , 7, 7 },
-		{ "Frequency Top"             , "4_24", 14, 0, 6, EVarType::Unsigned },
-		{ "Sweep Mode"                , "5_24", 4 , 6, 7, EVarType::Unsigned },
-		{ "Sweep Mode: Src"           , "6_24", 1 , 0, 2, EVarType::Unsigned, 2 , 6, 7 },
-		{ "LFO Frequency [Hz]"        , "7_24", 0 , 0, 2, EVarType::Unsigned, 1 , 3, 7 },
-		{ "Resonance"                 , "8_24", 12, 0, 6, EVarType::Unsigned },
-		{ "Low Pass Filter"           , "9_24", 14, 7, 7, EVarType::Unsigned },
-		{ "Routing"                   , "10_24", 13, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "11_24", 13, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "12_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "14_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "15_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "16_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[64] = { // Comp - Amp Sim
-		{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "CMP: Output Level"         , "2_24", 1 , 0, 6, EVarType::Unsigned },
-		{ "Amplifier Type"            , "3_24", 2 , 6, 7, EVarType::Unsigned },
-		{ "Routing"                   , "4_24", 1 , 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "5_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "6_24", 6 , 0, 3, EVarType::Unsigned, 7 , 7, 7 },
-		{ "Wet/Dry: Amt"              , "7_24", 0 , 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "8_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "9_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "10_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[65] = { // Comp - OD/HiGain
-		{ "Sensitivity"               , "0_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 13, 0, 6, EVarType::Unsigned },
-		{ "CMP: Output Level"         , "2_24", 14, 0, 6, EVarType::Unsigned },
-		{ "Drive Mode"                , "3_24", 13, 7, 7, EVarType::Unsigned },
-		{ "Drive"                     , "4_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "OD: Output Level"          , "5_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Low Cutoff[Hz]"            , "6_24", 1 , 0, 2, EVarType::Unsigned, 2 , 5, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "7_24", 0 , 0, 0, EVarType::Signed, 1 , 3, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "8_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "9_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Mid1: Gain [dB]"           , "10_24", 4 , 2, 7, EVarType::Signed },
-		{ "Mid2 Cutoff[Hz]"           , "11_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Mid2: Q"                   , "12_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Mid2: Gain [dB]"           , "13_24", 6 , 2, 7, EVarType::Signed },
-		{ "Routing"                   , "14_24", 14, 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "15_24", 0 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "16_24", 12, 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "17_24", 15, 0, 7, EVarType::Signed },
-		{ "OD: Output Level: Src"     , "18_24", 9 , 0, 4, EVarType::Unsigned },
-		{ "OD: Output Level: Amt"     , "19_24", 8 , 0, 3, EVarType::Signed, 9 , 5, 7 } };
-
-	effect_conversions[66] = { // Comp - Param4EQ
-		{ "Sensitivity"               , "0_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 13, 0, 6, EVarType::Unsigned },
-		{ "CMP: Output Level"         , "2_24", 14, 0, 6, EVarType::Unsigned },
-		{ "Trim"                      , "3_24", 12, 0, 6, EVarType::Unsigned },
-		{ "Band1 Cutoff [Hz]"         , "4_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "5_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "6_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "7_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "8_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "9_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "10_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "11_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "12_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "13_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "14_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "15_24", 6 , 2, 7, EVarType::Signed },
-		{ "Routing"                   , "16_24", 14, 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "17_24", 10, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "18_24", 9 , 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "19_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[67] = { // Comp - Cho/Flng
-		{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "CMP: Output Level"         , "2_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Delay Time [msec]"         , "3_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "LFO Waveform"              , "4_24", 4 , 7, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "5_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "6_24", 0 , 0, 2, EVarType::Unsigned, 1 , 5, 7 },
-		{ "Feedback"                  , "7_24", 5 , 0, 6, EVarType::Signed },
-		{ "Cho/Flng Wet/Dry"          , "8_24", 6 , 0, 6, EVarType::Signed },
-		{ "Output Mode"               , "9_24", 5 , 7, 7, EVarType::Unsigned },
-		{ "Routing"                   , "10_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "11_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "12_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
-		{ "Trim"                      , "14_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "15_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "16_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[68] = { // Comp - Phaser
-		{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "CMP: Output Level"         , "2_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "LFO Waveform"              , "3_24", 4 , 7, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "4_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Manual"                    , "5_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "Depth"                     , "6_24", 0 , 0, 2, EVarType::Unsigned, 1 , 5, 7 },
-		{ "Resonance"                 , "7_24", 5 , 0, 6, EVarType::Signed },
-		{ "Phaser Wet/Dry"            , "8_24", 6 , 0, 6, EVarType::Signed },
-		{ "Output Mode"               , "9_24", 5 , 7, 7, EVarType::Unsigned },
-		{ "Routing"                   , "10_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "11_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "12_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
-		{ "Trim"                      , "14_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "15_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "16_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[69] = { // Comp - Mt.Delay
-		{ "Sensitivity"               , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Attack"                    , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "CMP: Output Level"         , "2_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Tap1 Time [msec]"          , "3_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Tap2 Time [msec]"          , "4_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Tap1 Level"                , "5_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "Feedback (Tap2)"           , "6_24", 14, 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "7_24", 5 , 0, 6, EVarType::Unsigned },
-		{ "Mt.Delay Wet/Dry"          , "8_24", 6 , 0, 6, EVarType::Unsigned },
-		{ "Routing"                   , "9_24", 1 , 5, 5, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "10_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Wet/Dry: Amt"              , "12_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "13_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "14_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "15_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[70] = { // Limiter - P4EQ
-		{ "Ratio"                     , "0_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "1_24", 15, 0, 6, EVarType::Signed },
-		{ "Attack"                    , "2_24", 10, 0, 4, EVarType::Unsigned, 11, 6, 7 },
-		{ "Release"                   , "3_24", 9 , 0, 3, EVarType::Unsigned, 10, 5, 7 },
-		{ "Gain Adjust [dB]"          , "4_24", 11, 0, 5, EVarType::Signed },
-		{ "Trim"                      , "5_24", 8 , 0, 2, EVarType::Unsigned, 9 , 4, 7 },
-		{ "Band1 Cutoff [Hz]"         , "6_24", 1 , 0, 5, EVarType::Unsigned },
-		{ "Band1: Q"                  , "7_24", 0 , 0, 1, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Band1: Gain [dB]"          , "8_24", 0 , 2, 7, EVarType::Signed },
-		{ "Band2 Cutoff [Hz]"         , "9_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Band2: Q"                  , "10_24", 2 , 0, 1, EVarType::Unsigned, 3 , 6, 7 },
-		{ "Band2: Gain [dB]"          , "11_24", 2 , 2, 7, EVarType::Signed },
-		{ "Band3 Cutoff[Hz]"          , "12_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Band3: Q"                  , "13_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Band3: Gain [dB]"          , "14_24", 4 , 2, 7, EVarType::Signed },
-		{ "Band4 Cutoff [Hz]"         , "15_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Band4: Q"                  , "16_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Band4: Gain [dB]"          , "17_24", 6 , 2, 7, EVarType::Signed },
-		{ "Routing"                   , "18_24", 12, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "19_24", 12, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "20_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 14, 0, 7, EVarType::Signed } };
-
-	effect_conversions[71] = { // Limiter - Cho/Flng
-		{ "Ratio"                     , "0_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "1_24", 3 , 0, 6, EVarType::Signed },
-		{ "Attack"                    , "2_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Release"                   , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Gain Adjust [dB]"          , "4_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
-		{ "Delay Time [msec]"         , "5_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "LFO Waveform"              , "6_24", 4 , 7, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "7_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "8_24", 12, 0, 5, EVarType::Unsigned },
-		{ "Feedback"                  , "9_24", 5 , 0, 6, EVarType::Signed },
-		{ "Cho/Flng Wet/Dry"          , "10_24", 6 , 0, 6, EVarType::Signed },
-		{ "Output Mode"               , "11_24", 5 , 7, 7, EVarType::Unsigned },
-		{ "Routing"                   , "12_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "13_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "16_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "17_24", 10, 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "18_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[72] = { // Limiter - Phaser
-		{ "Ratio"                     , "0_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "1_24", 3 , 0, 6, EVarType::Signed },
-		{ "Attack"                    , "2_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Release"                   , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Gain Adjust [dB]"          , "4_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
-		{ "LFO Waveform"              , "5_24", 4 , 7, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "6_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Manual"                    , "7_24", 4 , 0, 6, EVarType::Unsigned },
-		{ "Depth"                     , "8_24", 12, 0, 5, EVarType::Unsigned },
-		{ "Resonance"                 , "9_24", 5 , 0, 6, EVarType::Signed },
-		{ "Phaser Wet/Dry"            , "10_24", 6 , 0, 6, EVarType::Signed },
-		{ "Output Mode"               , "11_24", 5 , 7, 7, EVarType::Unsigned },
-		{ "Routing"                   , "12_24", 6 , 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "13_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[73] = { // Limiter - Mt. Delay
-		{ "Ratio"                     , "0_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "1_24", 3 , 0, 6, EVarType::Signed },
-		{ "Attack"                    , "2_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Release"                   , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Gain Adjust [dB]"          , "4_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
-		{ "Tap1 Time [msec]"          , "5_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Tap2 Time [msec]"          , "6_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Tap1 Level"                , "7_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Feedback (Tap2)"           , "8_24", 14, 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "9_24", 8 , 0, 6, EVarType::Unsigned },
-		{ "Mt.Delay Wet/Dry"          , "10_24", 9 , 0, 6, EVarType::Unsigned },
-		{ "Routing"                   , "11_24", 10, 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "12_24", 10, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "13_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "14_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[74] = { // Exciter - Comp
-		{ "Exciter Blend"             , "0_24", 0 , 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Sensitivity"               , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Attack"                    , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Output Level"              , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Routing"                   , "5_24", 14, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "6_24", 14, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "7_24", 13, 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "8_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "9_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "10_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "11_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[75] = { // Exciter - Limiter
-		{ "Exciter Blend"             , "0_24", 4 , 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "1_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Ratio"                     , "2_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "3_24", 3 , 0, 6, EVarType::Signed },
-		{ "Attack"                    , "4_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Release"                   , "5_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Gain Adjust [dB]"          , "6_24", 0 , 0, 2, EVarType::Signed, 1 , 5, 7 },
-		{ "Routing"                   , "7_24", 8 , 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "8_24", 8 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "9_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "10_24", 7 , 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "11_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "12_24", 9 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "13_24", 10, 0, 7, EVarType::Signed } };
-
-	effect_conversions[76] = { // Exciter - Cho/Flng
-		{ "Exciter Blend"             , "0_24", 4 , 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "1_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Delay Time [msec]"         , "2_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "LFO Waveform"              , "3_24", 6 , 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "4_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "5_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Feedback"                  , "6_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
-		{ "Cho/Flng Wet/Dry"          , "7_24", 0 , 0, 2, EVarType::Signed, 1 , 4, 7 },
-		{ "Output Mode"               , "8_24", 9 , 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "9_24", 6 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 8 , 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "12_24", 9 , 1, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "13_24", 10, 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "14_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[77] = { // Exciter - Phaser
-		{ "Exciter Blend"             , "0_24", 4 , 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "1_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "LFO Waveform"              , "2_24", 6 , 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "3_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Manual"                    , "4_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Depth"                     , "5_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Resonance"                 , "6_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
-		{ "Phaser Wet/Dry"            , "7_24", 0 , 0, 2, EVarType::Signed, 1 , 4, 7 },
-		{ "Output Mode"               , "8_24", 9 , 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "9_24", 6 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 8 , 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "12_24", 9 , 1, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "13_24", 10, 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "14_24", 11, 0, 7, EVarType::Signed } };
-
-	effect_conversions[78] = { // Exciter - Mt.Delay
-		{ "Exciter Blend"             , "0_24", 10, 0, 7, EVarType::Signed },
-		{ "Emphatic Point"            , "1_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Tap1 Time [msec]"          , "2_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Tap2 Time [msec]"          , "3_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Tap1 Level"                , "4_24", 0 , 0, 6, EVarType::Unsigned },
-		{ "Feedback (Tap2)"           , "5_24", 14, 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "6_24", 1 , 0, 6, EVarType::Unsigned },
-		{ "Mt.Delay Wet/Dry"          , "7_24", 2 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "8_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "9_24", 5 , 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "10_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "11_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "12_24", 4 , 0, 1, EVarType::Signed, 5 , 5, 7 },
-		{ "Pre HEQ Gain [dB]"         , "13_24", 4 , 2, 6, EVarType::Signed } };
-
-	effect_conversions[79] = { // OD/HG - Amp Sim
-		{ "Drive Mode"                , "0_24", 13, 0, 0, EVarType::Unsigned },
-		{ "Drive"                     , "1_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "OD: Output Level"          , "2_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 2, EVarType::Unsigned, 2 , 5, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 0, EVarType::Signed, 1 , 3, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "5_24", 5 , 0, 5, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "6_24", 4 , 0, 1, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Mid1: Gain [dB]"           , "7_24", 4 , 2, 7, EVarType::Signed },
-		{ "Mid2 Cutoff[Hz]"           , "8_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Mid2: Q"                   , "9_24", 6 , 0, 1, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Mid2: Gain [dB]"           , "10_24", 6 , 2, 7, EVarType::Signed },
-		{ "Amplifier Type"            , "11_24", 14, 6, 7, EVarType::Unsigned },
-		{ "Routing"                   , "12_24", 14, 5, 5, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "13_24", 0 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 14, 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
-		{ "OD: Output Level: Src"     , "16_24", 12, 0, 4, EVarType::Unsigned },
-		{ "OD: Output Level: Amt"     , "17_24", 13, 1, 7, EVarType::Signed } };
-
-	effect_conversions[80] = { // OD/HG - Cho/Flng
-		{ "Drive Mode"                , "0_24", 3 , 0, 0, EVarType::Unsigned },
-		{ "Drive"                     , "1_24", 3 , 1, 7, EVarType::Unsigned },
-		{ "OD: Output Level"          , "2_24", 2 , 0, 5, EVarType::Unsigned },
-		{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "5_24", 0 , 2, 7, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "6_24", 9 , 0, 3, EVarType::Unsigned },
-		{ "Mid1: Gain [dB]"           , "7_24", 8 , 0, 1, EVarType::Signed, 9 , 4, 7 },
-		{ "Mid2 Cutoff[Hz]"           , "8_24", 8 , 2, 7, EVarType::Unsigned },
-		{ "Mid2: Q"                   , "9_24", 13, 0, 3, EVarType::Unsigned },
-		{ "Mid2: Gain [dB]"           , "10_24", 7 , 0, 5, EVarType::Signed },
-		{ "Delay Time [msec]"         , "11_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
-		{ "LFO Waveform"              , "12_24", 10, 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "13_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "14_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Feedback"                  , "15_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
-		{ "Cho/Flng Wet/Dry"          , "16_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
-		{ "Output Mode"               , "17_24", 11, 6, 6, EVarType::Unsigned },
-		{ "Routing"                   , "18_24", 11, 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "19_24", 10, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "20_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 15, 0, 7, EVarType::Signed },
-		{ "OD: Output Level: Src"     , "22_24", 12, 0, 0, EVarType::Unsigned, 13, 4, 7 },
-		{ "OD: Output Level: Amt"     , "23_24", 12, 1, 7, EVarType::Signed } };
-
-	effect_conversions[81] = { // OD/HG - Phaser
-		{ "Drive Mode"                , "0_24", 3 , 0, 0, EVarType::Unsigned },
-		{ "Drive"                     , "1_24", 3 , 1, 7, EVarType::Unsigned },
-		{ "OD: Output Level"          , "2_24", 2 , 0, 5, EVarType::Unsigned },
-		{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "5_24", 0 , 2, 7, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "6_24", 9 , 0, 3, EVarType::Unsigned },
-		{ "Mid1: Gain [dB]"           , "7_24", 8 , 0, 1, EVarType::Signed, 9 , 4, 7 },
-		{ "Mid2 Cutoff[Hz]"           , "8_24", 8 , 2, 7, EVarType::Unsigned },
-		{ "Mid2: Q"                   , "9_24", 13, 0, 3, EVarType::Unsigned },
-		{ "Mid2: Gain [dB]"           , "10_24", 7 , 0, 5, EVarType::Signed },
-		{ "LFO Waveform"              , "11_24", 10, 0, 0, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "12_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Manual"                    , "13_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Depth"                     , "14_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Resonance"                 , "15_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
-		{ "Phaser Wet/Dry"            , "16_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
-		{ "Output Mode"               , "17_24", 11, 6, 6, EVarType::Unsigned },
-		{ "Routing"                   , "18_24", 11, 7, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "19_24", 10, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "20_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "21_24", 15, 0, 7, EVarType::Signed },
-		{ "OD: Output Level: Src"     , "22_24", 12, 0, 0, EVarType::Unsigned, 13, 4, 7 },
-		{ "OD: Output Level: Amt"     , "23_24", 12, 1, 7, EVarType::Signed } };
-
-	effect_conversions[82] = { // OD/HG - Mt. Delay
-		{ "Drive Mode"                , "0_24", 3 , 0, 0, EVarType::Unsigned },
-		{ "Drive"                     , "1_24", 3 , 1, 7, EVarType::Unsigned },
-		{ "OD: Output Level"          , "2_24", 2 , 0, 5, EVarType::Unsigned },
-		{ "Low Cutoff[Hz]"            , "3_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "4_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "5_24", 0 , 2, 7, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "6_24", 9 , 0, 3, EVarType::Unsigned },
-		{ "Mid1: Gain [dB]"           , "7_24", 8 , 0, 1, EVarType::Signed, 9 , 4, 7 },
-		{ "Mid2 Cutoff[Hz]"           , "8_24", 8 , 2, 7, EVarType::Unsigned },
-		{ "Mid2: Q"                   , "9_24", 15, 0, 3, EVarType::Unsigned },
-		{ "Mid2: Gain [dB]"           , "10_24", 7 , 0, 5, EVarType::Signed },
-		{ "Tap1 Delay Time [msec]"    , "11_24", 6 , 0, 4, EVarType::Unsigned, 7 , 6, 7 },
-		{ "Tap2 Delay Time [msec]"    , "12_24", 5 , 0, 3, EVarType::Unsigned, 6 , 5, 7 },
-		{ "Tap1 Level"                , "13_24", 4 , 0, 0, EVarType::Unsigned, 5 , 4, 7 },
-		{ "Feedback (Tap2)"           , "14_24", 4 , 1, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "15_24", 14, 0, 1, EVarType::Unsigned, 15, 4, 7 },
-		{ "Mt.Delay Wet/Dry"          , "16_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "17_24", 13, 0, 0, EVarType::Unsigned, 14, 2, 7 },
-		{ "Wet/Dry: Src"              , "18_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Wet/Dry: Amt"              , "19_24", 12, 0, 0, EVarType::Signed, 13, 1, 7 },
-		{ "OD: Output Level: Src"     , "20_24", 10, 3, 7, EVarType::Unsigned },
-		{ "OD: Output Level: Amt"     , "21_24", 12, 1, 7, EVarType::Signed } };
-
-	effect_conversions[83] = { // Wah - Amp Sim
-		{ "Frequency Bottom"          , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Frequency Top"             , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Sweep Mode"                , "2_24", 12, 0, 1, EVarType::Unsigned },
-		{ "Sweep Mode: Src"           , "3_24", 1 , 0, 2, EVarType::Unsigned, 2 , 6, 7 },
-		{ "LFO Frequency [Hz]"        , "4_24", 0 , 0, 2, EVarType::Unsigned, 1 , 3, 7 },
-		{ "Resonance"                 , "5_24", 13, 0, 6, EVarType::Unsigned },
-		{ "Low Pass Filter"           , "6_24", 13, 7, 7, EVarType::Unsigned },
-		{ "Amplifier Type"            , "7_24", 12, 2, 3, EVarType::Unsigned },
-		{ "Routing"                   , "8_24", 14, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "9_24", 14, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[84] = { // Decimator - Amp
-		{ "Pre LPF"                   , "0_24", 5 , 0, 0, EVarType::Unsigned },
-		{ "Sampling Freq [Hz]"        , "1_24", 4 , 0, 1, EVarType::Unsigned, 5 , 1, 7 },
-		{ "High Damp [%]"             , "2_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Resolution"                , "3_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "DECI: Output Level"        , "4_24", 1 , 0, 3, EVarType::Unsigned, 2 , 5, 7 },
-		{ "Amplifier Type"            , "5_24", 4 , 2, 3, EVarType::Unsigned },
-		{ "Routing"                   , "6_24", 4 , 4, 4, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "7_24", 0 , 0, 2, EVarType::Unsigned, 1 , 4, 7 },
-		{ "Wet/Dry: Src"              , "8_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[85] = { // Decimator - Comp
-		{ "Pre LPF"                   , "0_24", 6 , 0, 0, EVarType::Unsigned },
-		{ "Sampling Freq [Hz]"        , "1_24", 4 , 0, 0, EVarType::Unsigned, 5 , 0, 7 },
-		{ "High Damp [%]"             , "2_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Resolution"                , "3_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "DECI: Output Level"        , "4_24", 1 , 0, 3, EVarType::Unsigned, 2 , 5, 7 },
-		{ "Sensitivity"               , "5_24", 0 , 0, 2, EVarType::Unsigned, 1 , 4, 7 },
-		{ "Attack"                    , "6_24", 4 , 1, 7, EVarType::Unsigned },
-		{ "CMP: Output Level"         , "7_24", 6 , 1, 7, EVarType::Unsigned },
-		{ "Routing"                   , "8_24", 7 , 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "9_24", 7 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "10_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "11_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[86] = { // Amp Sim - Tremolo
-		{ "Amplifier Type"            , "0_24", 3 , 0, 1, EVarType::Unsigned },
-		{ "LFO Waveform"              , "1_24", 3 , 2, 4, EVarType::Unsigned },
-		{ "LFO Shape"                 , "2_24", 14, 0, 7, EVarType::Signed },
-		{ "LFO Frequency [Hz]"        , "3_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "4_24", 2 , 0, 3, EVarType::Unsigned, 3 , 5, 7 },
-		{ "Wet/Dry"                   , "5_24", 1 , 0, 2, EVarType::Unsigned, 2 , 4, 7 },
-		{ "Wet/Dry: Src"              , "6_24", 1 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "7_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[87] = { // Cho/Flng - Mt.Dly
-		{ "Delay Time [msec]"         , "0_24", 10, 0, 6, EVarType::Unsigned },
-		{ "LFO Waveform"              , "1_24", 10, 7, 7, EVarType::Unsigned },
-		{ "LFO Frequency [Hz]"        , "2_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Depth"                     , "3_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Feedback"                  , "4_24", 2 , 0, 4, EVarType::Signed, 3 , 6, 7 },
-		{ "Cho/Flng Wet/Dry"          , "5_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
-		{ "Tap1 Time [msec]"          , "6_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Tap2 Time [msec]"          , "7_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Tap1 Level"                , "8_24", 0 , 0, 2, EVarType::Unsigned, 1 , 4, 7 },
-		{ "Feedback (Tap2)"           , "9_24", 14, 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "10_24", 8 , 0, 6, EVarType::Unsigned },
-		{ "Mt.Delay Wet/Dry"          , "11_24", 9 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "12_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "13_24", 0 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "14_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "15_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "16_24", 5 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "17_24", 6 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[88] = { // Phaser - Cho/Flng
-		{ "Phaser: LFO Waveform"      , "0_24", 12, 0, 0, EVarType::Unsigned },
-		{ "Phaser: LFO Frequency [Hz]", "1_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Manual"                    , "2_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Phaser: Depth"             , "3_24", 2 , 0, 4, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Resonance"                 , "4_24", 1 , 0, 3, EVarType::Signed, 2 , 5, 7 },
-		{ "Phaser Wet/Dry"            , "5_24", 0 , 0, 2, EVarType::Signed, 1 , 4, 7 },
-		{ "Delay Time [msec]"         , "6_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Flng: LFO Waveform"        , "7_24", 11, 0, 0, EVarType::Unsigned },
-		{ "Flng: LFO Frequency [Hz]"  , "8_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Flng: Depth"               , "9_24", 6 , 0, 4, EVarType::Unsigned, 7 , 7, 7 },
-		{ "Feedback"                  , "10_24", 5 , 0, 3, EVarType::Signed, 6 , 5, 7 },
-		{ "Cho/Flng Wet/Dry"          , "11_24", 4 , 0, 2, EVarType::Signed, 5 , 4, 7 },
-		{ "Output Mode"               , "12_24", 10, 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "13_24", 12, 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "16_24", 11, 1, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "17_24", 0 , 3, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "18_24", 10, 1, 5, EVarType::Signed } };
-
-	effect_conversions[89] = { // Reverb - Gate
-		{ "Reverb Time [sec]"         , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "High Damp [%]"             , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Pre Delay [msec]"          , "2_24", 14, 0, 7, EVarType::Unsigned },
-		{ "Reverb Balance"            , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Envelope Select"           , "4_24", 1 , 5, 5, EVarType::Unsigned },
-		{ "Envelope Select: Src"      , "5_24", 0 , 0, 2, EVarType::Unsigned, 1 , 6, 7 },
-		{ "Input Reverb Mix"          , "6_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Polarity"                  , "7_24", 7 , 0, 0, EVarType::Unsigned },
-		{ "Threshold"                 , "8_24", 7 , 1, 7, EVarType::Unsigned },
-		{ "Attack"                    , "9_24", 6 , 0, 6, EVarType::Unsigned },
-		{ "Release"                   , "10_24", 5 , 0, 5, EVarType::Unsigned, 6 , 7, 7 },
-		{ "Wet/Dry"                   , "11_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
-		{ "Wet/Dry: Src"              , "12_24", 4 , 0, 2, EVarType::Unsigned, 5 , 6, 7 },
-		{ "Wet/Dry: Amt"              , "13_24", 15, 0, 7, EVarType::Signed },
-		{ "EQ Trim"                   , "14_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
-		{ "Pre LEQ Gain [dB]"         , "15_24", 4 , 3, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "16_24", 0 , 3, 7, EVarType::Signed } };
-
-	effect_conversions[90] = { // Piano Body/Damper
-		{ "Sound Board Depth"         , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Damper Depth"              , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Damper Depth: Src"         , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Tone"                      , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Mid Shape"                 , "4_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "5_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "7_24", 7 , 0, 7, EVarType::Signed },
-		{ "Tune"                      , "8_24", 8 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[91] = { // St. Mltband Limiter
-		{ "Ratio"                     , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Threshold [dB]"            , "1_24", 1 , 0, 7, EVarType::Signed },
-		{ "Attack"                    , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Release"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Low Offset [dB]"           , "4_24", 5 , 0, 7, EVarType::Signed },
-		{ "Mid Offset [dB]"           , "5_24", 6 , 0, 7, EVarType::Signed },
-		{ "High Offset [dB]"          , "6_24", 7 , 0, 7, EVarType::Signed },
-		{ "Gain Adjust [dB]"          , "7_24", 4 , 0, 7, EVarType::Signed },
-		{ "Gain Adjust: Src"          , "8_24", 11, 0, 7, EVarType::Unsigned },
-		{ "Gain Adjust: Amt"          , "9_24", 12, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "10_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 10, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 9 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[92] = { // OD/HyperGain Wah
-		{ "Wah"                       , "0_24", 11, 0, 0, EVarType::Unsigned },
-		{ "Wah: Src"                  , "1_24", 11, 1, 5, EVarType::Unsigned },
-		{ "Wah.Sw"                    , "2_24", 3 , 0, 0, EVarType::Unsigned },
-		{ "Wah Sweep Range"           , "3_24", 10, 3, 7, EVarType::Signed },
-		{ "Wah Sweep Src"             , "4_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Drive Mode"                , "5_24", 12, 0, 0, EVarType::Unsigned },
-		{ "Drive"                     , "6_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Pre Low-cut"               , "7_24", 3 , 1, 4, EVarType::Unsigned },
-		{ "Output Level"              , "8_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Output Level: Src"         , "9_24", 9 , 0, 4, EVarType::Unsigned },
-		{ "Output Level: Amt"         , "10_24", 14, 0, 7, EVarType::Signed },
-		{ "Low Cutoff[Hz]"            , "11_24", 1 , 0, 3, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Low Cutoff: Gain [dB]"     , "12_24", 0 , 0, 1, EVarType::Signed, 1 , 4, 7 },
-		{ "Mid1 Cutoff[Hz]"           , "13_24", 0 , 2, 7, EVarType::Unsigned },
-		{ "Mid1: Q"                   , "14_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "Mid1: Gain [dB]"           , "15_24", 6 , 0, 3, EVarType::Signed, 7 , 6, 7 },
-		{ "Mid2 Cutoff[Hz]"           , "16_24", 5 , 0, 1, EVarType::Unsigned, 6 , 4, 7 },
-		{ "Mid2: Q"                   , "17_24", 5 , 2, 7, EVarType::Unsigned },
-		{ "Mid2: Gain [dB]"           , "18_24", 8 , 0, 2, EVarType::Signed, 9 , 5, 7 },
-		{ "Direct Mix"                , "19_24", 12, 1, 6, EVarType::Unsigned },
-		{ "Speaker Simulation"        , "20_24", 4 , 0, 0, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "21_24", 4 , 1, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "22_24", 8 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[93] = { // Vocoder
-		{ "L (Carrier)   Trim"        , "0_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "R (Modulator) Trim"        , "1_24", 2 , 0, 5, EVarType::Unsigned, 3 , 7, 7 },
-		{ "Formant Shift"             , "2_24", 10, 0, 2, EVarType::Signed },
-		{ "Response"                  , "3_24", 1 , 0, 4, EVarType::Unsigned, 2 , 6, 7 },
-		{ "Noise Level"               , "4_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Noise Level: Src"          , "5_24", 0 , 0, 1, EVarType::Unsigned, 1 , 5, 7 },
-		{ "Noise Level: Amt"          , "6_24", 13, 0, 7, EVarType::Signed },
-		{ "Low Gain [dB]"             , "7_24", 0 , 2, 7, EVarType::Signed },
-		{ "High Gain [dB]"            , "8_24", 6 , 0, 4, EVarType::Signed, 7 , 7, 7 },
-		{ "Modulator High Mix"        , "9_24", 5 , 0, 3, EVarType::Unsigned, 6 , 5, 7 },
-		{ "Vocoder/Carrier"           , "10_24", 4 , 0, 2, EVarType::Unsigned, 5 , 4, 7 },
-		{ "Vocoder/Carrier: Src"      , "11_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Vocoder/Carrier: Amt"      , "12_24", 14, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "13_24", 12, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "14_24", 11, 0, 4, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "15_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[94] = { // Multitap Cho/Delay
-		{ "LFO Frequency [Hz]"        , "0_24", 3 , 0, 5, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "1_24", 4 , 0, 2, EVarType::Unsigned, 5 , 4, 7 },
-		{ "Tap1 Feedback: Src"        , "2_24", 4 , 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "3_24", 2 , 0, 7, EVarType::Signed },
-		{ "Tap6 (300) [msec]"         , "4_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Tap1 (000) [msec]"         , "5_24", 14, 0, 5, EVarType::Unsigned, 15, 7, 7 },
-		{ "Tap3 (060) [msec]"         , "6_24", 13, 0, 4, EVarType::Unsigned, 14, 6, 7 },
-		{ "Tap5 (120) [msec]"         , "7_24", 12, 0, 3, EVarType::Unsigned, 13, 5, 7 },
-		{ "Tap2 (180) [msec]"         , "8_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Tap4 (240) [msec]"         , "9_24", 10, 0, 5, EVarType::Unsigned, 11, 7, 7 },
-		{ "Tap6: Depth"               , "10_24", 9 , 0, 2, EVarType::Unsigned, 10, 6, 7 },
-		{ "Tap1: Depth"               , "11_24", 9 , 3, 7, EVarType::Unsigned },
-		{ "Tap3: Depth"               , "12_24", 7 , 0, 4, EVarType::Unsigned },
-		{ "Tap5: Depth"               , "13_24", 6 , 0, 1, EVarType::Unsigned, 7 , 5, 7 },
-		{ "Tap2: Depth"               , "14_24", 6 , 2, 6, EVarType::Unsigned },
-		{ "Tap4: Depth"               , "15_24", 5 , 0, 3, EVarType::Unsigned, 6 , 7, 7 },
-		{ "Tap6: Status"              , "16_24", 12, 4, 5, EVarType::Unsigned },
-		{ "Tap1: Status"              , "17_24", 12, 6, 7, EVarType::Unsigned },
-		{ "Tap3: Status"              , "18_24", 8 , 0, 1, EVarType::Unsigned },
-		{ "Tap5: Status"              , "19_24", 8 , 2, 3, EVarType::Unsigned },
-		{ "Tap2: Status"              , "20_24", 8 , 4, 5, EVarType::Unsigned },
-		{ "Tap4: Status"              , "21_24", 8 , 6, 7, EVarType::Unsigned },
-		{ "Tap1 Feedback"             , "22_24", 0 , 0, 7, EVarType::Signed },
-		{ "Tap1 Feedback: Amt"        , "23_24", 1 , 0, 7, EVarType::Signed },
-		{ "Panning Preset"            , "24_24", 3 , 6, 7, EVarType::Unsigned } };
-
-	effect_conversions[95] = { // St. Pitch Shifter
-		{ "Input Level: Src"          , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Input Level Dmod [%]"      , "1_24", 1 , 0, 7, EVarType::Signed },
-		{ "Mode"                      , "2_24", 15, 5, 6, EVarType::Unsigned },
-		{ "L/R Pitch"                 , "3_24", 15, 7, 7, EVarType::Unsigned },
-		{ "Pitch Shift [1/2tone]"     , "4_24", 2 , 0, 7, EVarType::Signed },
-		{ "Pitch Shift: Src"          , "5_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Pitch Shift: Amt"          , "6_24", 4 , 0, 7, EVarType::Signed },
-		{ "Fine [cent]"               , "7_24", 5 , 0, 7, EVarType::Signed },
-		{ "Fine: Amt"                 , "8_24", 6 , 0, 7, EVarType::Signed },
-		{ "Lch Delay [msec]"          , "9_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Rch Delay [msec]"          , "10_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Feedback Position"         , "11_24", 10, 0, 0, EVarType::Unsigned },
-		{ "Feedback"                  , "12_24", 9 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "13_24", 10, 1, 7, EVarType::Unsigned },
-		{ "Spread"                    , "14_24", 11, 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "15_24", 12, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "16_24", 13, 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "17_24", 14, 0, 7, EVarType::Signed } };
-
-	effect_conversions[96] = { // Rotary Speaker OD
-		{ "Overdrive"                 , "0_24", 12, 7, 7, EVarType::Unsigned },
-		{ "Overdrive: Src"            , "1_24", 11, 0, 4, EVarType::Unsigned },
-		{ "Overdrive: Sw"             , "2_24", 3 , 7, 7, EVarType::Unsigned },
-		{ "Overdrive Gain"            , "3_24", 1 , 0, 6, EVarType::Unsigned },
-		{ "Overdrive Level"           , "4_24", 0 , 0, 5, EVarType::Unsigned, 1 , 7, 7 },
-		{ "Overdrive Tone"            , "5_24", 10, 4, 7, EVarType::Unsigned },
-		{ "Speaker Simulator"         , "6_24", 2 , 0, 0, EVarType::Unsigned },
-		{ "Mode Switch"               , "7_24", 2 , 1, 1, EVarType::Unsigned },
-		{ "Mode Switch: Src"          , "8_24", 13, 0, 4, EVarType::Unsigned },
-		{ "Mode Switch: Sw"           , "9_24", 5 , 7, 7, EVarType::Unsigned },
-		{ "Speed Switch"              , "10_24", 2 , 2, 2, EVarType::Unsigned },
-		{ "Speed Switch: Src"         , "11_24", 12, 0, 1, EVarType::Unsigned, 13, 5, 7 },
-		{ "Speed Switch: Sw"          , "12_24", 7 , 7, 7, EVarType::Unsigned },
-		{ "Manual Speed Ctrl"         , "13_24", 2 , 3, 7, EVarType::Unsigned },
-		{ "Rotor Acceleration"        , "14_24", 3 , 0, 6, EVarType::Unsigned },
-		{ "Rotor Ratio"               , "15_24", 4 , 0, 7, EVarType::Unsigned },
-		{ "Horn Acceleration"         , "16_24", 5 , 0, 6, EVarType::Unsigned },
-		{ "Horn Ratio"                , "17_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Horn/Rotor Balance"        , "18_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Mic Distance"              , "19_24", 8 , 0, 7, EVarType::Unsigned },
-		{ "Mic Spread"                , "20_24", 9 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "21_24", 10, 0, 3, EVarType::Unsigned, 11, 5, 7 },
-		{ "Wet/Dry: Src"              , "22_24", 12, 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "23_24", 15, 0, 7, EVarType::Signed } };
-
-	effect_conversions[97] = { // Early Reflections
-		{ "Type"                      , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "ER Time [msec]"            , "1_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Pre Delay [msec]"          , "2_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "EQ Trim"                   , "3_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Pre LEQ Gain [dB]"         , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "Pre HEQ Gain [dB]"         , "5_24", 5 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "6_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "7_24", 7 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "8_24", 8 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[98] = { // L/C/R Long Delay
-		{ "L Delay Time [msec]"       , "0_24", 2 , 0, 3, EVarType::Unsigned, 3 , 0, 7 },
-		{ "L Delay Level"             , "1_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "C Delay Time [msec]"       , "2_24", 1 , 0, 7, EVarType::Unsigned, 2 , 4, 7 },
-		{ "C Delay Level"             , "3_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
-		{ "R Delay Time [msec]"       , "4_24", 5 , 0, 7, EVarType::Unsigned, 6 , 4, 7 },
-		{ "R Delay Level"             , "5_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Feedback (C Delay)"        , "6_24", 0 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "7_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Feedback: Amt"             , "8_24", 4 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "9_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
-		{ "Low Damp [%]"              , "10_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Input Level: Src"          , "11_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
-		{ "Input Level Dmod [%]"      , "12_24", 8 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "13_24", 9 , 2, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "14_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
-		{ "Wet/Dry: Src"              , "15_24", 13, 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "16_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[99] = { // St/Cross Long Dly
-		{ "L Delay Time [msec]"       , "0_24", 14, 0, 5, EVarType::Unsigned, 15, 0, 7 },
-		{ "R Delay Time [msec]"       , "1_24", 12, 0, 3, EVarType::Unsigned, 13, 0, 7, Byte(14, 6, 7) },
-		{ "Wet/Dry"                   , "2_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "3_24", 8 , 0, 1, EVarType::Unsigned, 9 , 5, 7 },
-		{ "Wet/Dry: Amt"              , "4_24", 4 , 0, 7, EVarType::Signed },
-		{ "L Feedback"                , "5_24", 0 , 0, 7, EVarType::Signed },
-		{ "R Feedback"                , "6_24", 1 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "7_24", 8 , 2, 6, EVarType::Unsigned },
-		{ "L Feedback: Amt"           , "8_24", 2 , 0, 7, EVarType::Signed },
-		{ "R Feedback: Amt"           , "9_24", 3 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "10_24", 9 , 0, 4, EVarType::Unsigned, 10, 6, 7 },
-		{ "Low Damp [%]"              , "11_24", 7 , 0, 6, EVarType::Unsigned },
-		{ "Input Level Src"           , "12_24", 6 , 0, 3, EVarType::Unsigned, 7 , 7, 7 },
-		{ "Input Level Dmod [%]"      , "13_24", 5 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "14_24", 10, 0, 5, EVarType::Signed, 11, 7, 7 },
-		{ "Stereo/Cross"              , "15_24", 8 , 7, 7, EVarType::Unsigned } };
-
-	effect_conversions[100] = { // LCR BPM Long Dly
-		{ "BPM"                       , "0_24", 5 , 0, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "1_24", 1 , 2, 2, EVarType::Unsigned },
-		{ "L Delay Base Note"         , "2_24", 3 , 0, 2, EVarType::Unsigned },
-		{ "L Delay Base Note: Times"  , "3_24", 6 , 4, 7, EVarType::Unsigned },
-		{ "L Delay Level"             , "4_24", 7 , 0, 5, EVarType::Unsigned },
-		{ "C Delay Base Note"         , "5_24", 3 , 3, 5, EVarType::Unsigned },
-		{ "C Delay Base Note: Times"  , "6_24", 2 , 1, 4, EVarType::Unsigned },
-		{ "C Delay Level"             , "7_24", 6 , 0, 3, EVarType::Unsigned, 7 , 6, 7 },
-		{ "R Delay Base Note"         , "8_24", 2 , 0, 0, EVarType::Unsigned, 3 , 6, 7 },
-		{ "R Delay Base Note: Times"  , "9_24", 1 , 0, 0, EVarType::Unsigned, 2 , 5, 7 },
-		{ "R Delay Level"             , "10_24", 11, 0, 5, EVarType::Unsigned },
-		{ "Time Over? >"              , "11_24", 1 , 1, 1, EVarType::Signed },
-		{ "Feedback (C Delay)"        , "12_24", 0 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "13_24", 10, 0, 2, EVarType::Unsigned, 11, 6, 7 },
-		{ "Feedback: Amt"             , "14_24", 4 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "15_24", 9 , 0, 1, EVarType::Unsigned, 10, 3, 7 },
-		{ "Low Damp [%]"              , "16_24", 15, 0, 6, EVarType::Unsigned },
-		{ "Input Level Src"           , "17_24", 14, 0, 3, EVarType::Unsigned, 15, 7, 7 },
-		{ "Input Level Dmod [%]"      , "18_24", 8 , 0, 7, EVarType::Signed },
-		{ "Spread"                    , "19_24", 9 , 2, 7, EVarType::Unsigned },
-		{ "Wet/Dry"                   , "20_24", 13, 0, 2, EVarType::Unsigned, 14, 4, 7 },
-		{ "Wet/Dry: Src"              , "21_24", 13, 3, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "22_24", 12, 0, 7, EVarType::Signed } };
-
-	effect_conversions[101] = { // St. BPM Long Delay
-		{ "BPM"                       , "0_24", 4 , 0, 7, EVarType::Unsigned },
-		//{ "(Reserved)"                , "1_24", 9 , 7, 7, EVarType::Unsigned },
-		{ "L Delay Base Note"         , "2_24", 5 , 0, 2, EVarType::Unsigned },
-		{ "L Delay Base Note: Times"  , "3_24", 5 , 3, 6, EVarType::Unsigned },
-		{ "L Delay: Adjust [%]"       , "4_24", 10, 0, 7, EVarType::Signed, 11, 7, 7 },
-		{ "Time Over? L >"            , "5_24", 5 , 7, 7, EVarType::Signed },
-		{ "R Delay Base Note"         , "6_24", 6 , 0, 2, EVarType::Unsigned },
-		{ "R Delay Base Note: Times"  , "7_24", 6 , 3, 6, EVarType::Unsigned },
-		{ "R Delay: Adjust [%]"       , "8_24", 12, 0, 7, EVarType::Signed, 13, 7, 7 },
-		{ "Time Over? R >"            , "9_24", 6 , 7, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "10_24", 9 , 0, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "11_24", 14, 2, 6, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "12_24", 8 , 0, 7, EVarType::Signed },
-		{ "L Feedback"                , "13_24", 0 , 0, 7, EVarType::Signed },
-		{ "R Feedback"                , "14_24", 1 , 0, 7, EVarType::Signed },
-		{ "Feedback: Src"             , "15_24", 15, 0, 4, EVarType::Unsigned },
-		{ "L Feedback: Amt"           , "16_24", 2 , 0, 7, EVarType::Signed },
-		{ "R Feedback: Amt"           , "17_24", 3 , 0, 7, EVarType::Signed },
-		{ "High Damp [%]"             , "18_24", 11, 0, 6, EVarType::Unsigned },
-		{ "Low Damp [%]"              , "19_24", 13, 0, 6, EVarType::Unsigned },
-		{ "Input Level Src"           , "20_24", 14, 0, 1, EVarType::Unsigned, 15, 5, 7 },
-		{ "Input Level Dmod [%]"      , "21_24", 7 , 0, 7, EVarType::Signed } };
-
-	effect_conversions[102] = { // Hold Delay
-		{ "REC Control Src"           , "0_24", 0 , 0, 7, EVarType::Unsigned },
-		{ "Manual REC Control"        , "1_24", 8 , 4, 4, EVarType::Unsigned },
-		{ "RST Control Src"           , "2_24", 1 , 0, 7, EVarType::Unsigned },
-		{ "Manual RST Control"        , "3_24", 8 , 5, 5, EVarType::Unsigned },
-		{ "Pan"                       , "4_24", 2 , 0, 7, EVarType::Unsigned },
-		{ "Pan: Src"                  , "5_24", 3 , 0, 7, EVarType::Unsigned },
-		{ "Pan: Amt"                  , "6_24", 4 , 0, 7, EVarType::Signed },
-		{ "Wet/Dry"                   , "7_24", 5 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Src"              , "8_24", 6 , 0, 7, EVarType::Unsigned },
-		{ "Wet/Dry: Amt"              , "9_24", 7 , 0, 7, EVarType::Signed },
-		{ "Loop Time [msec]"          , "10_24", 8 , 0, 3, EVarType::Unsigned, 9 , 0, 7 } };
+	if (effectType <= 0 || effectType >= kEffectTypeCount)
+		return {};
+
+	auto& range = kEffectConversionRanges[effectType];
+	return { kEffectConversions + range.first, range.count };
 }
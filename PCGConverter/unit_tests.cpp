@@ -14,10 +14,96 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
 
 #include "rapidjson/document.h"
 #include "rapidjson/istreamwrapper.h"
 
+// Reference sign extension: the bitfield narrowing the converter used before signExtend
+template<typename T, int Bits>
+struct SignedBitField { T d : Bits; };
+
+template<int Bits>
+int bitFieldSignExtend(int value)
+{
+	if constexpr ((Bits >= 2 && Bits <= 13) || Bits == 16)
+	{
+		SignedBitField<std::conditional_t<(Bits <= 8), char, short>, Bits> field;
+		field.d = value;
+		return field.d;
+	}
+	else
+	{
+		return value;
+	}
+}
+
+static_assert(signExtend<4>(0xF) == -1 && signExtend<4>(0x7) == 7);
+static_assert(signExtend<8>(0x80) == -128 && signExtend<8>(-1) == -1);
+static_assert(signExtend<13>(0x1000) == -4096 && signExtend<13>(0xFFF) == 4095);
+static_assert(signExtend<16>(0x8000) == -32768);
+static_assert(signExtend<1>(1) == 1 && signExtend<14>(0x2000) == 0x2000);
+
+template<int Bits>
+bool doSignExtensionTest(std::string& outLog)
+{
+	bool bErrors = false;
+	auto check = [&](const std::string& what, int input, int expected, int value)
+	{
+		if (expected == value)
+			return;
+
+		std::stringstream ss;
+		ss << "\terror: " << what << " (" << Bits << " bits) of " << input << ": " << expected << " != " << value << "\n";
+		outLog.append(ss.str());
+		bErrors = true;
+	};
+
+	// Every value the fields can assemble, and the sign extended bytes of single part fields
+	for (int value = -0x10000; value < 0x10000; value++)
+	{
+		auto expected = bitFieldSignExtend<Bits>(value);
+		check("signExtend", value, expected, signExtend<Bits>(value));
+		check("signExtensionShift", value, expected, signExtendWithShift(value, signExtensionShift(Bits)));
+	}
+
+	// Signed fields, read from one byte or split on two bytes
+	for (int msbBits = std::max(1, Bits - 8); msbBits <= std::min(8, Bits); msbBits++)
+	{
+		const int lsbBits = Bits - msbBits;
+		const int msbStart = 8 - msbBits;
+
+		TritonStruct info;
+		info.pcgOffset = 0;
+		info.pcgBitStart = msbStart;
+		info.pcgBitEnd = 7;
+		if (lsbBits > 0)
+		{
+			info.pcgLSBOffset = 1;
+			info.pcgLSBBitStart = 0;
+			info.pcgLSBBitEnd = lsbBits - 1;
+		}
+
+		for (int bytes = 0; bytes < 0x10000; bytes++)
+		{
+			unsigned char data[2] = { static_cast<unsigned char>(bytes >> 8), static_cast<unsigned char>(bytes) };
+			int raw = ((data[0] >> msbStart) << lsbBits) | (data[1] & ((1 << lsbBits) - 1));
+			check("getPCGValue", bytes, bitFieldSignExtend<Bits>(raw), PCG_Converter::getPCGValue(data, info));
+		}
+	}
+
+	return !bErrors;
+}
+
+// Widths 1 to 16: every width of the PCG fields
+template<int... Widths>
+bool doSignExtensionTests(std::string& outLog, std::integer_sequence<int, Widths...>)
+{
+	return (doSignExtensionTest<Widths + 1>(outLog) & ...);
+}
+
 bool doUnitTest(const PCG_Converter* converterTemplate, KorgPCG* pcg, EPatchMode type, const std::string& unitTestFolder,
 	const std::string& pcgBankLetter, int pcgProgId, const std::string& patchRefName, std::string& outLog)
 {
@@ -47,29 +133,18 @@ bool doUnitTest(const PCG_Converter* converterTemplate, KorgPCG* pcg, EPatchMode
 
 	bool bErrors = false;
 
-	KorgBanks* container = (type == EPatchMode::Program) ? pcg->Program : pcg->Combination;
+	KorgBank* const* slots = (type == EPatchMode::Program) ? pcg->ProgramSlots : pcg->CombinationSlots;
 	std::string subfolder = (type == EPatchMode::Program) ? "Program" : "Combi";
 	std::string jsonPrefix = (type == EPatchMode::Program) ? "prog_" : "combi_";
 
 	auto converter = PCG_Converter(*converterTemplate, unitTestFolder);
 
-	KorgBank* foundBank = nullptr;
-
-	for (uint32_t i = 0; i < container->count; i++)
-	{
-		auto* bank = container->bank[i];
-		auto bankLetter = Helpers::bankIdToLetter(bank->bank);
-
-		if (bankLetter == pcgBankLetter)
-		{
-			foundBank = bank;
-			break;
-		}
-	}
+	auto* bankDef = Helpers::findBankDefByName(pcgBankLetter);
+	KorgBank* foundBank = bankDef ? slots[bankDef->shortId] : nullptr;
 
 	assert(pcgProgId >= 0 && pcgProgId < 128);
 	assert(foundBank);
-	auto* item = foundBank->item[pcgProgId];
+	auto* item = GetKorgItem(foundBank, pcgProgId);
 	std::string pcgPresetName = std::string((char*)item->data, 16);
 
 	std::stringstream generatedStream;
@@ -304,6 +379,13 @@ void doUnitTests()
 
 	auto t1 = std::chrono::high_resolution_clock::now();
 
+	{
+		std::cout << "\n### Unit Tests for: Sign extension ### \n";
+
+		std::string outLog;
+		std::cout << (doSignExtensionTests(outLog, std::make_integer_sequence<int, 16>{}) ? "OK\n" : "ERRORS:\n") << outLog;
+	}
+
 	processTests("TritonExtreme", EPatchMode::Combi);
 	processTests("TritonExtreme", EPatchMode::Program);
 	processTests("Triton", EPatchMode::Combi);
@@ -32,6 +32,8 @@ void Worker::process()
 
     if (converter.isInitialized())
     {
+        converter.setWorkerCount(std::thread::hardware_concurrency());
+
         auto process = [](auto& selected, auto&& func)
         {
             if (!selected.empty())
@@ -0,0 +1,41 @@
+# Generates a C++ file holding the given resources as constant byte arrays, see PCGConverter/embedded_resources.h
+# Usage: cmake -DOUTPUT=<file.cpp> -DRESOURCES="<file1>|<file2>|..." -P EmbedResources.cmake
+
+if(NOT OUTPUT OR NOT RESOURCES)
+    message(FATAL_ERROR "EmbedResources.cmake: OUTPUT and RESOURCES are required")
+endif()
+
+string(REPLACE "|" ";" RESOURCES "${RESOURCES}")
+
+set(CONTENT "// Generated by cmake/EmbedResources.cmake, do not edit\n#include \"embedded_resources.h\"\n\n")
+set(ENTRIES "")
+set(INDEX 0)
+
+foreach(RESOURCE ${RESOURCES})
+    file(SIZE "${RESOURCE}" RESOURCE_SIZE)
+    if(RESOURCE_SIZE EQUAL 0)
+        continue()
+    endif()
+
+    get_filename_component(RESOURCE_NAME "${RESOURCE}" NAME)
+    file(READ "${RESOURCE}" HEX_CONTENT HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${HEX_CONTENT}")
+    # One line per 32 bytes
+    string(REGEX REPLACE "((0x[0-9a-f][0-9a-f],){32})" "\\1\n" BYTES "${BYTES}")
+
+    string(APPEND CONTENT "// ${RESOURCE_NAME}\nstatic const unsigned char kResource${INDEX}[] = {\n${BYTES}\n};\n\n")
+    string(APPEND ENTRIES "    { \"${RESOURCE_NAME}\", kResource${INDEX}, ${RESOURCE_SIZE} },\n")
+    math(EXPR INDEX "${INDEX} + 1")
+endforeach()
+
+if(INDEX EQUAL 0)
+    message(FATAL_ERROR "EmbedResources.cmake: no resource to embed")
+endif()
+
+string(APPEND CONTENT "extern const EmbeddedResource kEmbeddedResources[] = {\n${ENTRIES}};\n\n")
+string(APPEND CONTENT "extern const size_t kEmbeddedResourceCount = ${INDEX};\n")
+
+file(WRITE "${OUTPUT}.tmp" "${CONTENT}")
+# Only touch the output when it changed, to avoid recompiling it
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${OUTPUT}.tmp" "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")